@@ -30,6 +30,7 @@
 #include "mint/memory/symboltable.h"
 #include "mint/memory/reference.h"
 #include "mint/system/poolallocator.hpp"
+#include "mint/system/stackallocator.hpp"
 #include "mint/debug/lineinfo.h"
 
 #include <cstdint>
@@ -42,12 +43,13 @@ namespace mint {
 struct SavedState;
 class AbstractSyntaxTree;
 
-class MINT_EXPORT Cursor {
+class MINT_EXPORT Cursor : public MemoryRoot {
 	friend class AbstractSyntaxTree;
 	friend class CursorDebugger;
 	friend struct SavedState;
 public:
 	class MINT_EXPORT Call {
+		friend class Cursor;
 	public:
 		enum Flag : std::uint8_t {
 			STANDARD_CALL = 0x00,
@@ -79,26 +81,34 @@ public:
 		Reference &function();
 
 	private:
-		StrongReference m_function;
+		WeakReference m_function;
 		Class *m_metadata = nullptr;
 		int m_extra_args = 0;
 		Flags m_flags = STANDARD_CALL;
 	};
 
-	using waiting_call_stack_t = std::stack<Call, std::vector<Call>>;
+	class MINT_EXPORT WaitingCallStack : public std::stack<Call, std::vector<Call>> {
+	public:
+		[[nodiscard]] const container_type &calls() const {
+			return c;
+		}
+	};
+
+	using waiting_call_stack_t = WaitingCallStack;
 
 	Cursor() = delete;
 	Cursor(Cursor &&other) = delete;
 	Cursor(const Cursor &other) = delete;
 	Cursor &operator=(Cursor &&other) = delete;
 	Cursor &operator=(const Cursor &other) = delete;
-	~Cursor();
+	~Cursor() override;
 
 	[[nodiscard]] AbstractSyntaxTree *ast() const;
 	[[nodiscard]] Cursor *parent() const;
 
 	inline Node &next();
 	void jmp(size_t pos);
+	void replace_command(Node::Command command);
 	void call(Module::Handle *handle, int signature, Class *metadata = nullptr);
 	void call(Module *module, size_t pos, PackageData *package, Class *metadata = nullptr);
 	void exit_call();
@@ -141,6 +151,8 @@ public:
 protected:
 	Cursor(AbstractSyntaxTree *ast, Module *module, Cursor *parent = nullptr);
 
+	void mark() override;
+
 	struct Context {
 		Context() = delete;
 		explicit Context(Module *module);
@@ -154,9 +166,10 @@ protected:
 		std::vector<StrongReference> generator_expression;
 		std::vector<Printer *> printers;
 		SymbolTable *symbols = nullptr;
-		Reference *generator = nullptr;
+		WeakReference *generator = nullptr;
 		Module *module = nullptr;
 		size_t iptr = 0;
+		bool stacked = false;
 	};
 
 	struct RetrievePoint {
@@ -170,6 +183,15 @@ private:
 	using retrieve_point_stack_t = std::stack<RetrievePoint, std::vector<RetrievePoint>>;
 	static PoolAllocator<Context> g_pool;
 
+	static constexpr const size_t CONTEXT_SIZE = ((sizeof(Context) - 1) / StackAllocator::ALIGNMENT + 1)
+												* StackAllocator::ALIGNMENT;
+	static constexpr const size_t SYMBOL_TABLE_SIZE = ((sizeof(SymbolTable) - 1) / StackAllocator::ALIGNMENT + 1)
+													  * StackAllocator::ALIGNMENT;
+
+	Context *create_context(Module *module);
+	Context *create_stacked_context(Module *module, Module::Handle *handle, Class *metadata);
+	void destroy_context(Context *context);
+
 	AbstractSyntaxTree *m_ast;
 	Cursor *m_parent;
 	Cursor *m_child;
@@ -178,6 +200,7 @@ private:
 	waiting_call_stack_t m_waiting_calls;
 	std::vector<Context *> m_call_stack;
 	Context *m_current_context;
+	StackAllocator m_frames;
 
 	retrieve_point_stack_t m_retrieve_points;
 };
@@ -29,6 +29,7 @@
 
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace mint {
@@ -38,6 +39,7 @@ class PackageData;
 
 class MINT_EXPORT Module {
 	friend class AbstractSyntaxTree;
+	friend class Cursor;
 	friend class MainBranch;
 	friend class BubBranch;
 public:
@@ -87,6 +89,7 @@ public:
 	Handle *make_builtin_handle(PackageData *package, Id module, size_t offset);
 
 	Reference *make_constant(Data *data);
+	MemberCache *make_member_cache();
 	Symbol *make_symbol(const char *name);
 
 protected:
@@ -96,12 +99,14 @@ protected:
 	void push_nodes(const std::vector<Node> &nodes);
 	void push_nodes(const std::initializer_list<Node> &nodes);
 	void replace_node(size_t offset, const Node &node);
+	void pop_nodes(size_t count);
 
 private:
 	std::vector<Node> m_tree;
 	std::vector<Handle *> m_handles;
-	std::vector<Reference *> m_constants;
-	std::map<std::string, Symbol *> m_symbols;
+	std::vector<StrongReference *> m_constants;
+	std::vector<MemberCache *> m_member_caches;
+	std::unordered_map<Symbol, Symbol *> m_symbols;
 };
 
 Node &Module::at(size_t idx) {
@@ -29,6 +29,8 @@
 
 namespace mint {
 
+class MemberCache;
+
 union MINT_EXPORT Node {
 	enum Command : std::uint8_t {
 		LOAD_MODULE,
@@ -159,18 +161,49 @@ union MINT_EXPORT Node {
 		EXIT_CALL,
 		EXIT_THREAD,
 		EXIT_EXEC,
-		EXIT_MODULE
+		EXIT_MODULE,
+
+		LOAD_FAST_LOAD_FAST,
+		LOAD_FAST_LOAD_CONSTANT,
+		LOAD_FAST_LOAD_MEMBER,
+		ADD_OP_MOVE_OP,
+		SUB_OP_MOVE_OP,
+		MUL_OP_MOVE_OP,
+		MOVE_OP_UNLOAD_REFERENCE,
+		EQ_OP_JUMP_ZERO,
+		NE_OP_JUMP_ZERO,
+		LT_OP_JUMP_ZERO,
+		GT_OP_JUMP_ZERO,
+		LE_OP_JUMP_ZERO,
+		GE_OP_JUMP_ZERO,
+		INIT_MEMBER_CALL_MEMBER,
+
+		ADD_NUMBER_NUMBER,
+		SUB_NUMBER_NUMBER,
+		MUL_NUMBER_NUMBER,
+		DIV_NUMBER_NUMBER,
+		EQ_NUMBER_NUMBER,
+		NE_NUMBER_NUMBER,
+		LT_NUMBER_NUMBER,
+		GT_NUMBER_NUMBER,
+		LE_NUMBER_NUMBER,
+		GE_NUMBER_NUMBER,
+		ADD_STRING_STRING,
+		EQ_STRING_STRING,
+		NE_STRING_STRING
 	};
 
 	Node(Command command);
 	Node(int parameter);
 	Node(Symbol *symbol);
 	Node(Reference *constant);
+	Node(MemberCache *cache);
 
 	Command command;
 	int parameter;
 	Symbol *symbol;
 	Reference *constant;
+	MemberCache *cache;
 };
 
 }
@@ -26,11 +26,13 @@
 
 #include "mint/config.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
 #include <string_view>
 #include <cstring>
 #include <string>
+#include <utility>
 
 namespace mint {
 
@@ -38,20 +40,18 @@ class MINT_EXPORT Symbol {
 public:
 	using hash_t = std::size_t;
 
-	Symbol(std::string_view symbol) noexcept :
-		m_size(symbol.length()),
-		m_hash(make_symbol_hash(symbol)),
-		m_symbol(make_symbol_data(symbol.data(), symbol.length())) {}
+	Symbol(std::string_view symbol) :
+		m_entry(intern(symbol)) {}
 
-	Symbol(const char *symbol) noexcept :
+	Symbol(const char *symbol) :
 		Symbol(std::string_view(symbol)) {}
 
-	Symbol(Symbol &&other) noexcept;
-	Symbol(const Symbol &other);
-	~Symbol();
+	inline Symbol(Symbol &&other) noexcept;
+	inline Symbol(const Symbol &other) noexcept;
+	inline ~Symbol();
 
-	Symbol &operator=(const Symbol &other);
-	Symbol &operator=(Symbol &&other) noexcept;
+	inline Symbol &operator=(const Symbol &other) noexcept;
+	inline Symbol &operator=(Symbol &&other) noexcept;
 
 	inline bool operator==(const Symbol &other) const;
 	inline bool operator!=(const Symbol &other) const;
@@ -59,6 +59,8 @@ public:
 	[[nodiscard]] inline hash_t hash() const;
 	[[nodiscard]] inline std::string str() const;
 
+	[[nodiscard]] static size_t interned_count();
+
 private:
 #if !defined(__x86_64__) && !defined(_WIN64)
 	static constexpr const hash_t FNV_PRIME = 16777619u;
@@ -78,18 +80,23 @@ private:
 				   : hash;
 	}
 
-	static char *make_symbol_data(const char *data, size_t length) {
-		char *copy = (char *)malloc(length + 1);
-		if (copy == nullptr) {
-			return nullptr;
-		}
-		copy[length] = '\0';
-		return (char *)memcpy(copy, data, length);
-	}
-	
-	size_t m_size;
-	hash_t m_hash;
-	char *m_symbol;
+	/**
+	 * Each distinct name is stored once for the whole process, a symbol only
+	 * refers to its entry. The entry is removed from the table with the last
+	 * symbol referring to it, so the names built at runtime do not stay in the
+	 * table.
+	 */
+	struct Entry {
+		hash_t hash;
+		std::size_t size;
+		const char *name;
+		mutable std::atomic_size_t refcount;
+	};
+
+	static const Entry *intern(std::string_view symbol);
+	static void release(const Entry *entry);
+
+	const Entry *m_entry;
 };
 
 namespace builtin_symbols {
@@ -138,20 +145,52 @@ static const Symbol SHOW_METHOD("show");
 
 }
 
+Symbol::Symbol(Symbol &&other) noexcept :
+	m_entry(other.m_entry) {
+	other.m_entry = nullptr;
+}
+
+Symbol::Symbol(const Symbol &other) noexcept :
+	m_entry(other.m_entry) {
+	m_entry->refcount.fetch_add(1, std::memory_order_relaxed);
+}
+
+Symbol::~Symbol() {
+	if (m_entry) {
+		release(m_entry);
+	}
+}
+
+Symbol &Symbol::operator=(const Symbol &other) noexcept {
+	if (m_entry != other.m_entry) {
+		other.m_entry->refcount.fetch_add(1, std::memory_order_relaxed);
+		if (m_entry) {
+			release(m_entry);
+		}
+		m_entry = other.m_entry;
+	}
+	return *this;
+}
+
+Symbol &Symbol::operator=(Symbol &&other) noexcept {
+	std::swap(m_entry, other.m_entry);
+	return *this;
+}
+
 Symbol::hash_t Symbol::hash() const {
-	return m_hash;
+	return m_entry->hash;
 }
 
 std::string Symbol::str() const {
-	return {m_symbol, m_size};
+	return {m_entry->name, m_entry->size};
 }
 
 bool Symbol::operator==(const Symbol &other) const {
-	return LIKELY((m_size == other.m_size) && memcmp(m_symbol, other.m_symbol, m_size) == 0);
+	return m_entry == other.m_entry;
 }
 
 bool Symbol::operator!=(const Symbol &other) const {
-	return UNLIKELY((m_size != other.m_size) || memcmp(m_symbol, other.m_symbol, m_size) != 0);
+	return m_entry != other.m_entry;
 }
 
 }
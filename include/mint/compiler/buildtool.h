@@ -171,6 +171,7 @@ public:
 	void push_node(int parameter);
 	void push_node(const char *symbol);
 	void push_node(Data *constant);
+	void push_member_cache();
 
 	void start_operator(Class::Operator op);
 	Class::Operator retrieve_operator();
@@ -187,6 +188,8 @@ protected:
 	void push_node(Reference *constant);
 	void push_node(Symbol *symbol);
 
+	bool fold_constants(Node::Command command);
+
 	void push_branch(Branch *branch);
 	void pop_branch();
 
@@ -44,6 +44,7 @@ using byte_t = unsigned char;
 
 #define LIKELY(expr) (expr)
 #define UNLIKELY(expr) (expr)
+#define PREFETCH(addr) ((void)(addr))
 
 #ifdef BUILD_MINT_LIB
 #define MINT_EXPORT DECL_EXPORT
@@ -57,6 +58,7 @@ using byte_t = unsigned char;
 
 #define LIKELY(expr) __builtin_expect(!!(expr), true)
 #define UNLIKELY(expr) __builtin_expect(!!(expr), false)
+#define PREFETCH(addr) __builtin_prefetch(addr)
 #endif
 
 #endif // MINT_CONFIG_H
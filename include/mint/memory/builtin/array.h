@@ -51,13 +51,11 @@ public:
 	Array &operator=(Array &&other) noexcept;
 	Array &operator=(const Array &other);
 
-	void mark() override;
-
 	using values_type = std::vector<WeakReference>;
 	values_type values;
 
 private:
-	static LocalPool<Array> g_pool;
+	static HeapPool<Array> g_pool;
 };
 
 MINT_EXPORT void array_new(Cursor *cursor, size_t length);
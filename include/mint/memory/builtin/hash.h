@@ -51,8 +51,6 @@ public:
 	Hash &operator=(Hash &&other) noexcept;
 	Hash &operator=(const Hash &other);
 
-	void mark() override;
-
 	using key_type = WeakReference;
 	using value_type = WeakReference;
 
@@ -72,7 +70,7 @@ public:
 	values_type values;
 
 private:
-	static LocalPool<Hash> g_pool;
+	static HeapPool<Hash> g_pool;
 };
 
 MINT_EXPORT void hash_new(Cursor *cursor, size_t length);
@@ -69,8 +69,6 @@ public:
 	static Iterator *from_inclusive_range(double begin, double end);
 	static Iterator *from_exclusive_range(double begin, double end);
 
-	void mark() override;
-
 	class MINT_EXPORT Context {
 	public:
 		enum Type : std::uint8_t {
@@ -138,7 +136,7 @@ public:
 	Context ctx;
 
 private:
-	static LocalPool<Iterator> g_pool;
+	static HeapPool<Iterator> g_pool;
 };
 
 MINT_EXPORT void iterator_new(Cursor *cursor, size_t length);
@@ -47,7 +47,7 @@ public:
 	impl_type *impl = nullptr;
 
 private:
-	static SystemPool<LibObject<Type>> g_pool;
+	static HeapPool<LibObject<Type>> g_pool;
 };
 
 template<typename Type>
@@ -55,7 +55,7 @@ LibObject<Type>::LibObject() :
 	Object(LibObjectClass::instance()) {}
 
 template<typename Type>
-SystemPool<LibObject<Type>> LibObject<Type>::g_pool;
+HeapPool<LibObject<Type>> LibObject<Type>::g_pool;
 
 }
 
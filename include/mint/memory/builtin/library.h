@@ -54,7 +54,7 @@ public:
 	Plugin *plugin;
 
 private:
-	static LocalPool<Library> g_pool;
+	static HeapPool<Library> g_pool;
 };
 }
 
@@ -55,7 +55,7 @@ public:
 	std::regex expr;
 
 private:
-	static LocalPool<Regex> g_pool;
+	static HeapPool<Regex> g_pool;
 };
 }
 
@@ -55,7 +55,7 @@ public:
 	std::string str;
 
 private:
-	static LocalPool<String> g_pool;
+	static HeapPool<String> g_pool;
 };
 }
 
@@ -32,8 +32,10 @@
 namespace mint {
 
 struct MemoryInfos {
-	bool reachable = true;
 	bool collected = false;
+	bool destroyed = false;
+	bool sampled = false;
+	std::uint32_t grey = 0;
 	size_t refcount = 0;
 };
 
@@ -58,18 +60,16 @@ public:
 
 	const Format format;
 
-	virtual void mark();
+	void mark();
+
+	[[nodiscard]] inline bool is_unique() const;
 
 protected:
 	explicit Data(Format fmt);
 	virtual ~Data() = default;
 
-	[[nodiscard]] bool marked_bit() const;
-
 private:
 	MemoryInfos infos;
-	Data *prev = nullptr;
-	Data *next = nullptr;
 };
 
 struct MINT_EXPORT None : public Data {
@@ -84,6 +84,10 @@ protected:
 	Null();
 };
 
+bool Data::is_unique() const {
+	return infos.refcount == 1;
+}
+
 }
 
 #endif // MINT_DATA_H
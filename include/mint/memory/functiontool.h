@@ -33,7 +33,9 @@
 #include "mint/config.h"
 
 #include <initializer_list>
+#include <functional>
 #include <string>
+#include <vector>
 
 #ifdef OS_WINDOWS
 #include <BaseTsd.h>
@@ -71,6 +73,26 @@ private:
 
 class MINT_EXPORT FunctionHelper {
 public:
+	using PinnedReferences = std::initializer_list<std::reference_wrapper<const Reference>>;
+
+	class MINT_EXPORT BlockingRegion {
+		friend class FunctionHelper;
+	public:
+		BlockingRegion(BlockingRegion &&) = delete;
+		BlockingRegion(const BlockingRegion &) = delete;
+		~BlockingRegion();
+
+		BlockingRegion &operator=(BlockingRegion &&) = delete;
+		BlockingRegion &operator=(const BlockingRegion &) = delete;
+
+	protected:
+		explicit BlockingRegion(PinnedReferences pinned);
+		explicit BlockingRegion(const std::vector<WeakReference> &pinned);
+
+	private:
+		std::vector<StrongReference> m_pinned;
+	};
+
 	FunctionHelper(Cursor *cursor, size_t argc);
 	FunctionHelper(FunctionHelper &&) = delete;
 	FunctionHelper(const FunctionHelper &) = default;
@@ -86,6 +108,12 @@ public:
 
 	void return_value(Reference &&value);
 
+	[[nodiscard]] BlockingRegion blocking_region(PinnedReferences pinned = {}) const;
+	[[nodiscard]] BlockingRegion blocking_region(const std::vector<WeakReference> &pinned) const;
+
+	template<class Function>
+	auto blocking_call(Function &&function, PinnedReferences pinned = {}) const;
+
 private:
 	Cursor *m_cursor;
 	ssize_t m_top;
@@ -97,6 +125,7 @@ MINT_EXPORT WeakReference create_function(Module::Info &module, int signature, c
 
 MINT_EXPORT WeakReference create_number(double value);
 MINT_EXPORT WeakReference create_boolean(bool value);
+MINT_EXPORT WeakReference share_boolean(bool value);
 MINT_EXPORT WeakReference create_string(const char *value);
 MINT_EXPORT WeakReference create_string(const std::string &value);
 MINT_EXPORT WeakReference create_string(std::string_view value);
@@ -135,6 +164,12 @@ MINT_EXPORT WeakReference get_member_ignore_visibility(Object *object, const Sym
 MINT_EXPORT WeakReference get_global_ignore_visibility(Object *object, const Symbol &global);
 MINT_EXPORT WeakReference find_enum_value(Object *object, double value);
 
+template<class Function>
+auto FunctionHelper::blocking_call(Function &&function, PinnedReferences pinned) const {
+	BlockingRegion region(pinned);
+	return std::forward<Function>(function)();
+}
+
 template<class... Items>
 WeakReference create_iterator(Items... items) {
 	WeakReference ref = WeakReference::create<Iterator>(sizeof...(items));
@@ -26,8 +26,18 @@
 
 #include "mint/config.h"
 #include "mint/memory/data.h"
+#include "mint/memory/heap.h"
+#include "mint/memory/heapprofiler.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <set>
 
@@ -37,6 +47,38 @@ class WeakReference;
 class MemoryRoot;
 struct Object;
 
+struct GarbageCollectorStatistics {
+	static constexpr const size_t FORMAT_COUNT = Data::FMT_FUNCTION + 1;
+	static constexpr const size_t METATYPE_COUNT = 8;
+
+	struct DataStatistics {
+		std::uint64_t live_objects;
+		std::uint64_t live_bytes;
+		std::uint64_t marked_objects;
+		std::uint64_t marked_bytes;
+		std::uint64_t swept_objects;
+		std::uint64_t swept_bytes;
+	};
+
+	std::uint64_t young_collections;
+	std::uint64_t full_collections;
+	std::uint64_t pauses;
+	std::chrono::nanoseconds pause_time;
+	std::chrono::nanoseconds max_pause_time;
+	std::chrono::nanoseconds last_pause_time;
+	size_t young_objects;
+	size_t old_objects;
+	size_t roots;
+	size_t stacks;
+	size_t heap_pages;
+	size_t heap_bytes;
+	size_t reference_infos;
+	size_t reference_info_chunks;
+	std::uint64_t reclaimed_bytes;
+	std::array<DataStatistics, FORMAT_COUNT> formats;
+	std::array<DataStatistics, METATYPE_COUNT> metatypes;
+};
+
 class MINT_EXPORT GarbageCollector {
 	friend struct Data;
 	friend class MemoryRoot;
@@ -45,6 +87,11 @@ class MINT_EXPORT GarbageCollector {
 	friend class WeakReference;
 	friend class StrongReference;
 public:
+	static constexpr const size_t DEFAULT_COLLECTION_THRESHOLD = 0x10000;
+	static constexpr const double DEFAULT_COLLECTION_GROWTH = 2.;
+	static constexpr const std::chrono::microseconds DEFAULT_COLLECTION_SLICE = std::chrono::microseconds(1000);
+	static constexpr const size_t DEFAULT_RECLAIM_DELAY = 2;
+
 	GarbageCollector(GarbageCollector &&other) = delete;
 	GarbageCollector(const GarbageCollector &other) = delete;
 
@@ -57,8 +104,37 @@ public:
 	Type *alloc(Args &&...args);
 
 	size_t collect();
+	size_t collect_young();
+	bool collect_incrementally(std::chrono::microseconds budget);
 	void clean();
 
+	void set_collection_threshold(size_t count);
+	[[nodiscard]] size_t collection_threshold() const;
+	void set_collection_growth(double ratio);
+	[[nodiscard]] double collection_growth() const;
+	void set_collection_slice(std::chrono::microseconds budget);
+	[[nodiscard]] std::chrono::microseconds collection_slice() const;
+	void set_collection_threads(size_t count);
+	[[nodiscard]] size_t collection_threads() const;
+	void set_reclaim_delay(size_t count);
+	[[nodiscard]] size_t reclaim_delay() const;
+
+	[[nodiscard]] inline bool collection_requested() const;
+	[[nodiscard]] inline bool collection_in_progress() const;
+	bool collect_if_requested();
+
+	[[nodiscard]] GarbageCollectorStatistics statistics() const;
+
+	void start_heap_profiler(size_t sampling_interval = HeapProfiler::DEFAULT_SAMPLING_INTERVAL);
+	void stop_heap_profiler();
+	[[nodiscard]] HeapProfiler *heap_profiler() const;
+	static void request_heap_profile();
+
+	void suspend_automatic_collection();
+	void resume_automatic_collection();
+	void enter_blocking_region();
+	void leave_blocking_region();
+
 	inline void use(Data *data);
 	inline void release(Data *data);
 
@@ -73,24 +149,98 @@ protected:
 
 	Data *copy(const Data *other);
 	void free(Data *ptr);
+	void free_data(Data *ptr);
 	void destroy(Data *ptr);
 	void destroy(Object *ptr);
 
 private:
-	GarbageCollector() = default;
+	enum CollectionPhase : std::uint8_t {
+		IDLE,
+		MARKING,
+		SWEEPING
+	};
+
+	class WorkerPool;
+
+	GarbageCollector();
 	~GarbageCollector();
 
+	static constexpr const size_t PREFETCH_DISTANCE = 8;
+
+	void mark(Data *data);
+	inline void shade(Data *data);
+	inline void barrier(Data *data);
+	inline void shade_later(Data *data);
+	void shade_pending();
+
+	template<class Marker>
+	static void trace(Marker &marker, Data *data);
+
+	template<class Filter>
+	static std::unordered_map<Data *, size_t> count_internal_references(const std::vector<HeapPage *> &pages,
+																		 HeapPage::Bitmap HeapPage::*holders,
+																		 Filter filter);
+
+	void start_cycle();
+	bool mark_slice(std::chrono::steady_clock::time_point deadline);
+	bool sweep_slice(std::chrono::steady_clock::time_point deadline);
+	size_t finish_cycle();
+
+	[[nodiscard]] bool use_worker_pool(std::chrono::steady_clock::time_point deadline) const;
+	WorkerPool *worker_pool();
+	void mark_in_parallel();
+	void sweep_in_parallel();
+	void sweep_page(HeapPage *page, std::vector<Data *> &collected, size_t &young_count, size_t &old_count,
+					GarbageCollectorStatistics &statistics);
+
+	[[nodiscard]] size_t next_major_collection() const;
+	static inline bool is_young(const Data *data);
+	void promote_young_generation();
+	void dispose(const std::vector<Data *> &collected);
+	void destroy_referenced(Data *ptr);
+	void reclaim_memory();
+	void record_pause(std::chrono::steady_clock::time_point start);
+	void sample_allocation(Data *data, size_t size);
+	inline void forget_allocation(Data *data);
+	void dump_heap_profile();
+
 	std::set<std::vector<WeakReference> *> m_stacks;
 
+	CollectionPhase m_phase = IDLE;
+	std::vector<Data *> m_grey;
+	std::array<Data *, PREFETCH_DISTANCE> m_pending = {};
+	size_t m_pending_index = 0;
+	std::vector<Data *> m_collected;
+	size_t m_sweep_page = 0;
+
+	std::vector<Data *> m_released;
+	bool m_releasing = false;
+
+	std::vector<HeapPage *> m_young_pages;
+	size_t m_young_count = 0;
+	size_t m_old_count = 0;
+	size_t m_next_major_collection = DEFAULT_COLLECTION_THRESHOLD;
+	size_t m_collection_threshold = DEFAULT_COLLECTION_THRESHOLD;
+	double m_collection_growth = DEFAULT_COLLECTION_GROWTH;
+	std::chrono::microseconds m_collection_slice = DEFAULT_COLLECTION_SLICE;
+	size_t m_collection_threads = 1;
+	WorkerPool *m_worker_pool = nullptr;
+	size_t m_reclaim_delay = DEFAULT_RECLAIM_DELAY;
+	std::atomic_size_t m_suspended_collections = 0;
+	std::atomic_size_t m_blocking_regions = 0;
+	bool m_collecting = false;
+	GarbageCollectorStatistics m_statistics = {};
+	size_t m_bytes_until_sample = std::numeric_limits<size_t>::max();
+	HeapProfiler *m_heap_profiler = nullptr;
+	std::string m_heap_profile_path;
+	static std::atomic_bool g_heap_profile_requested;
+
 	struct {
 		MemoryRoot *head = nullptr;
 		MemoryRoot *tail = nullptr;
 	} m_roots;
 
-	struct {
-		Data *head = nullptr;
-		Data *tail = nullptr;
-	} m_memory;
+	Heap &m_heap;
 };
 
 class MINT_EXPORT MemoryRoot {
@@ -115,7 +265,24 @@ private:
 
 template<class Type, typename... Args>
 Type *GarbageCollector::alloc(Args &&...args) {
-	return Type::g_pool.alloc(std::forward<Args>(args)...);
+	Type *data = Type::g_pool.alloc(std::forward<Args>(args)...);
+	if (UNLIKELY(m_bytes_until_sample <= sizeof(Type))) {
+		sample_allocation(data, sizeof(Type));
+	}
+	else {
+		m_bytes_until_sample -= sizeof(Type);
+	}
+	return data;
+}
+
+bool GarbageCollector::collection_requested() const {
+	// a requested heap profile is also written at the next safe point
+	return m_phase != IDLE || (m_collection_threshold && m_young_count >= m_collection_threshold)
+		   || UNLIKELY(g_heap_profile_requested.load(std::memory_order_relaxed));
+}
+
+bool GarbageCollector::collection_in_progress() const {
+	return m_phase != IDLE;
 }
 
 template<>
@@ -129,10 +296,59 @@ void GarbageCollector::use(Data *data) {
 }
 
 void GarbageCollector::release(Data *data) {
-	if (!data->infos.collected && !--data->infos.refcount) {
-		data->infos.collected = true;
-		unregister_data(data);
-		GarbageCollector::free(data);
+	if (!data->infos.collected) {
+		if (!--data->infos.refcount) {
+			data->infos.collected = true;
+			unregister_data(data);
+			GarbageCollector::free(data);
+		}
+		else {
+			barrier(data);
+		}
+	}
+	else if (!--data->infos.refcount && data->infos.destroyed) {
+		// the slot of a collected data is kept until its last reference is released
+		m_heap.deallocate(data);
+	}
+}
+
+void GarbageCollector::shade(Data *data) {
+	HeapPage *page = HeapPage::of(data);
+	const size_t granule = HeapPage::granule(data);
+	if (!page->marked.test(granule)) {
+		page->marked.set(granule);
+		m_grey.emplace_back(data);
+		data->infos.grey = static_cast<std::uint32_t>(m_grey.size());
+	}
+}
+
+void GarbageCollector::shade_later(Data *data) {
+	// the data is loaded while the next ones are traced
+	PREFETCH(data);
+	if (Data *previous = std::exchange(m_pending[m_pending_index], data)) {
+		shade(previous);
+	}
+	m_pending_index = (m_pending_index + 1) % PREFETCH_DISTANCE;
+}
+
+void GarbageCollector::forget_allocation(Data *data) {
+	if (UNLIKELY(data->infos.sampled)) {
+		data->infos.sampled = false;
+		if (m_heap_profiler) {
+			m_heap_profiler->release(data);
+		}
+	}
+}
+
+bool GarbageCollector::is_young(const Data *data) {
+	return HeapPage::of(data)->young.test(HeapPage::granule(data));
+}
+
+void GarbageCollector::barrier(Data *data) {
+	// a reference removed while marking keeps its target for the current cycle,
+	// so everything reachable when the cycle started is marked
+	if (UNLIKELY(m_phase == MARKING)) {
+		shade(data);
 	}
 }
 
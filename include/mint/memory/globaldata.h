@@ -26,6 +26,7 @@
 
 #include "mint/ast/classregister.h"
 #include "mint/memory/symboltable.h"
+#include "mint/memory/heap.h"
 
 #include <array>
 
@@ -84,6 +85,7 @@ public:
 
 	inline Reference *none_ref();
 	inline Reference *null_ref();
+	inline Reference *boolean_ref(bool value);
 
 	void cleanup_builtin();
 
@@ -93,8 +95,9 @@ protected:
 private:
 	static GlobalData *g_instance;
 	std::array<Class *, Class::BUILTIN_CLASS_COUNT> m_builtin;
-	Reference *m_none = nullptr;
-	Reference *m_null = nullptr;
+	StrongReference *m_none = nullptr;
+	StrongReference *m_null = nullptr;
+	std::array<StrongReference *, 2> m_booleans = {};
 };
 
 SymbolTable &PackageData::symbols() {
@@ -110,11 +113,28 @@ BuiltinClass *GlobalData::builtin(Class::Metatype type) {
 }
 
 Reference *GlobalData::none_ref() {
-	return m_none ? m_none : m_none = new StrongReference(Reference::CONST_ADDRESS | Reference::CONST_VALUE, new None);
+	if (m_none == nullptr) {
+		auto *none = new (Heap::instance().allocate(sizeof(None))) None;
+		m_none = new StrongReference(Reference::CONST_ADDRESS | Reference::CONST_VALUE, none);
+	}
+	return m_none;
 }
 
 Reference *GlobalData::null_ref() {
-	return m_null ? m_null : m_null = new StrongReference(Reference::CONST_ADDRESS | Reference::CONST_VALUE, new Null);
+	if (m_null == nullptr) {
+		auto *null = new (Heap::instance().allocate(sizeof(Null))) Null;
+		m_null = new StrongReference(Reference::CONST_ADDRESS | Reference::CONST_VALUE, null);
+	}
+	return m_null;
+}
+
+Reference *GlobalData::boolean_ref(bool value) {
+	StrongReference *&boolean = m_booleans[value];
+	if (boolean == nullptr) {
+		boolean = new StrongReference(Reference::CONST_ADDRESS | Reference::CONST_VALUE,
+									  GarbageCollector::instance().alloc<Boolean>(value));
+	}
+	return boolean;
 }
 
 }
@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2025 Gauvain CHERY.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef MINT_HEAP_H
+#define MINT_HEAP_H
+
+#include "mint/config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <array>
+
+#ifdef OS_WINDOWS
+#include <intrin.h>
+#ifdef _WIN64
+#pragma intrinsic(_BitScanForward64)
+#else
+#pragma intrinsic(_BitScanForward)
+#endif
+#pragma intrinsic(_InterlockedOr64)
+#endif
+
+namespace mint {
+
+struct MINT_EXPORT HeapPage {
+	static constexpr const size_t SIZE = 0x10000;
+	static constexpr const size_t GRANULE_SIZE = 0x10;
+	static constexpr const size_t GRANULE_COUNT = SIZE / GRANULE_SIZE;
+
+	/*
+	 * A bitmap has one bit per granule of the page. The bit of a slot is the
+	 * bit of the granule containing the address of its data.
+	 */
+	struct Bitmap {
+		static constexpr const size_t WORD_BITS = 64;
+		static constexpr const size_t WORD_COUNT = GRANULE_COUNT / WORD_BITS;
+
+		std::array<std::uint64_t, WORD_COUNT> words = {};
+
+		[[nodiscard]] inline bool test(size_t granule) const;
+		inline void set(size_t granule);
+		inline bool test_and_set(size_t granule);
+		inline void reset(size_t granule);
+		inline void clear();
+
+		static inline size_t lowest_bit(std::uint64_t word);
+	};
+
+	explicit HeapPage(size_t slot_size);
+
+	static inline HeapPage *of(const void *address);
+	static inline size_t granule(const void *address);
+	[[nodiscard]] inline void *address(size_t granule);
+
+	[[nodiscard]] inline bool is_full() const;
+	inline void *allocate();
+	inline void deallocate(void *address);
+
+	template<class Function>
+	void for_each(const Bitmap &bitmap, Function &&function);
+
+	const size_t slot_size;
+	HeapPage *next_available = nullptr;
+	bool available = true;
+	size_t used = 0;
+	size_t idle_collections = 0;
+	bool in_young_pages = false;
+
+	Bitmap allocated;
+	Bitmap marked;
+	Bitmap young;
+
+private:
+	void *m_free_list = nullptr;
+	byte_t *m_unused = nullptr;
+};
+
+class MINT_EXPORT Heap {
+public:
+	static constexpr const size_t MAX_SLOT_SIZE = 0x100;
+	static constexpr const size_t SIZE_CLASS_COUNT = MAX_SLOT_SIZE / HeapPage::GRANULE_SIZE;
+
+	Heap(Heap &&other) = delete;
+	Heap(const Heap &other) = delete;
+
+	Heap &operator=(Heap &&other) = delete;
+	Heap &operator=(const Heap &other) = delete;
+
+	static Heap &instance();
+
+	inline void *allocate(size_t size);
+	inline void deallocate(void *address);
+
+	[[nodiscard]] inline const std::vector<HeapPage *> &pages() const;
+
+	size_t reclaim(size_t delay);
+
+private:
+	Heap() = default;
+	~Heap();
+
+	HeapPage *create_page(size_t slot_size);
+
+	std::array<HeapPage *, SIZE_CLASS_COUNT> m_available = {};
+	std::vector<HeapPage *> m_pages;
+};
+
+bool HeapPage::Bitmap::test(size_t granule) const {
+	return words[granule / WORD_BITS] & (std::uint64_t(1) << (granule % WORD_BITS));
+}
+
+void HeapPage::Bitmap::set(size_t granule) {
+	words[granule / WORD_BITS] |= (std::uint64_t(1) << (granule % WORD_BITS));
+}
+
+bool HeapPage::Bitmap::test_and_set(size_t granule) {
+	// the bits can be set by several collector threads at the same time
+	const std::uint64_t mask = std::uint64_t(1) << (granule % WORD_BITS);
+	std::uint64_t *word = &words[granule / WORD_BITS];
+#ifdef OS_WINDOWS
+	return _InterlockedOr64(reinterpret_cast<volatile long long *>(word), static_cast<long long>(mask)) & mask;
+#else
+	return __atomic_fetch_or(word, mask, __ATOMIC_RELAXED) & mask;
+#endif
+}
+
+void HeapPage::Bitmap::reset(size_t granule) {
+	words[granule / WORD_BITS] &= ~(std::uint64_t(1) << (granule % WORD_BITS));
+}
+
+void HeapPage::Bitmap::clear() {
+	words.fill(0);
+}
+
+size_t HeapPage::Bitmap::lowest_bit(std::uint64_t word) {
+#ifdef OS_WINDOWS
+	unsigned long index = 0;
+#ifdef _WIN64
+	_BitScanForward64(&index, word);
+#else
+	if (!_BitScanForward(&index, static_cast<unsigned long>(word))) {
+		_BitScanForward(&index, static_cast<unsigned long>(word >> 32));
+		index += 32;
+	}
+#endif
+	return index;
+#else
+	return static_cast<size_t>(__builtin_ctzll(word));
+#endif
+}
+
+HeapPage *HeapPage::of(const void *address) {
+	return reinterpret_cast<HeapPage *>(reinterpret_cast<std::uintptr_t>(address) & ~(SIZE - 1));
+}
+
+size_t HeapPage::granule(const void *address) {
+	return (reinterpret_cast<std::uintptr_t>(address) & (SIZE - 1)) / GRANULE_SIZE;
+}
+
+void *HeapPage::address(size_t granule) {
+	return reinterpret_cast<byte_t *>(this) + granule * GRANULE_SIZE;
+}
+
+bool HeapPage::is_full() const {
+	return m_free_list == nullptr && m_unused + slot_size > reinterpret_cast<const byte_t *>(this) + SIZE;
+}
+
+void *HeapPage::allocate() {
+	++used;
+	if (void *slot = m_free_list) {
+		m_free_list = *static_cast<void **>(slot);
+		return slot;
+	}
+	void *slot = m_unused;
+	m_unused += slot_size;
+	return slot;
+}
+
+void HeapPage::deallocate(void *address) {
+	*static_cast<void **>(address) = m_free_list;
+	m_free_list = address;
+	--used;
+}
+
+template<class Function>
+void HeapPage::for_each(const Bitmap &bitmap, Function &&function) {
+	for (size_t index = 0; index < Bitmap::WORD_COUNT; ++index) {
+		for (std::uint64_t word = bitmap.words[index]; word; word &= word - 1) {
+			function(address(index * Bitmap::WORD_BITS + Bitmap::lowest_bit(word)));
+		}
+	}
+}
+
+void *Heap::allocate(size_t size) {
+
+	const size_t size_class = (size - 1) / HeapPage::GRANULE_SIZE;
+	HeapPage *page = m_available[size_class];
+
+	if (UNLIKELY(page == nullptr)) {
+		page = m_available[size_class] = create_page((size_class + 1) * HeapPage::GRANULE_SIZE);
+	}
+
+	void *slot = page->allocate();
+
+	if (UNLIKELY(page->is_full())) {
+		m_available[size_class] = page->next_available;
+		page->next_available = nullptr;
+		page->available = false;
+	}
+
+	return slot;
+}
+
+void Heap::deallocate(void *address) {
+
+	HeapPage *page = HeapPage::of(address);
+	page->deallocate(address);
+
+	if (UNLIKELY(!page->available)) {
+		const size_t size_class = page->slot_size / HeapPage::GRANULE_SIZE - 1;
+		page->next_available = m_available[size_class];
+		page->available = true;
+		m_available[size_class] = page;
+	}
+}
+
+const std::vector<HeapPage *> &Heap::pages() const {
+	return m_pages;
+}
+
+}
+
+#endif // MINT_HEAP_H
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2025 Gauvain CHERY.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+
+#ifndef MINT_HEAPPROFILER_H
+#define MINT_HEAPPROFILER_H
+
+#include "mint/config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mint {
+
+struct Data;
+
+/*
+ * Records the script lines allocating a sample of the data. An allocation of
+ * size bytes is sampled with a probability of 1 - exp(-size / interval) and
+ * stands for the data that were not sampled, so the profiles are estimations
+ * of the real allocations.
+ */
+class MINT_EXPORT HeapProfiler {
+public:
+	static constexpr const size_t DEFAULT_SAMPLING_INTERVAL = 0x80000;
+
+	enum Profile : std::uint8_t {
+		LIVE_OBJECTS,
+		LIVE_BYTES,
+		ALLOCATED_OBJECTS,
+		ALLOCATED_BYTES
+	};
+
+	explicit HeapProfiler(size_t sampling_interval = DEFAULT_SAMPLING_INTERVAL);
+	HeapProfiler(HeapProfiler &&) = delete;
+	HeapProfiler(const HeapProfiler &) = delete;
+	~HeapProfiler() = default;
+
+	HeapProfiler &operator=(HeapProfiler &&) = delete;
+	HeapProfiler &operator=(const HeapProfiler &) = delete;
+
+	[[nodiscard]] size_t sampling_interval() const;
+	size_t next_sample();
+
+	void sample(const Data *data, size_t size);
+	void release(const Data *data);
+
+	void write(FILE *stream, Profile profile) const;
+	bool dump(const std::filesystem::path &path, Profile profile) const;
+
+private:
+	struct Site {
+		std::string stack;
+		double allocated_objects = 0;
+		double allocated_bytes = 0;
+		double live_objects = 0;
+		double live_bytes = 0;
+	};
+
+	struct Sample {
+		size_t site;
+		double objects;
+		double bytes;
+	};
+
+	size_t m_sampling_interval;
+	std::minstd_rand m_generator;
+	std::exponential_distribution<double> m_distribution;
+	std::unordered_map<std::string, size_t> m_site_indexes;
+	std::vector<Site> m_sites;
+	std::unordered_map<const Data *, Sample> m_samples;
+};
+
+}
+
+#endif // MINT_HEAPPROFILER_H
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2025 Gauvain CHERY.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef MINT_MEMBERCACHE_H
+#define MINT_MEMBERCACHE_H
+
+#include "mint/memory/class.h"
+
+#include <array>
+#include <atomic>
+
+namespace mint {
+
+class Cursor;
+class PackageData;
+
+class MINT_EXPORT MemberCache {
+public:
+	static constexpr const size_t ENTRY_COUNT = 4;
+
+	static void invalidate_all();
+
+	Class::MemberInfo *find(const Cursor *cursor, Object *object);
+	void insert(const Cursor *cursor, Object *object, Class::MemberInfo *info);
+
+	[[nodiscard]] inline bool is_megamorphic() const;
+
+private:
+	struct Entry {
+		Class *metadata;
+		Class::MemberInfo *info;
+		Reference::Flags visibility;
+		Class *context;
+		PackageData *package;
+	};
+
+	static std::atomic_size_t g_generation;
+
+	size_t m_generation = 0;
+	size_t m_size = 0;
+	std::array<Entry, ENTRY_COUNT> m_entries;
+};
+
+bool MemberCache::is_megamorphic() const {
+	return m_size > ENTRY_COUNT && m_generation == g_generation.load(std::memory_order_relaxed);
+}
+
+}
+
+#endif // MINT_MEMBERCACHE_H
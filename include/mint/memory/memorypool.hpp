@@ -26,6 +26,7 @@
 
 #include "mint/system/poolallocator.hpp"
 #include "mint/system/assert.h"
+#include "mint/memory/heap.h"
 
 namespace mint {
 
@@ -77,13 +78,16 @@ class LocalPool : public MemoryPool, private PoolAllocator<Type> {
 public:
 	template<typename... Args>
 	Type *alloc(Args &&...args) {
-		return new (PoolAllocator<Type>::allocate()) Type(std::forward<Args>(args)...);
+		Type *object = new (PoolAllocator<Type>::allocate()) Type(std::forward<Args>(args)...);
+		++m_count;
+		return object;
 	}
 
 	void free(Type *object) {
 		assert(object);
 		object->Type::~Type();
 		PoolAllocator<Type>::deallocate(object);
+		--m_count;
 	}
 
 	void free(void *address) override {
@@ -91,6 +95,45 @@ public:
 		Type *object = static_cast<Type *>(address);
 		object->Type::~Type();
 		PoolAllocator<Type>::deallocate(object);
+		--m_count;
+	}
+
+	[[nodiscard]] size_t count() const {
+		return m_count;
+	}
+
+	[[nodiscard]] size_t chunk_count() const {
+		return PoolAllocator<Type>::chunk_count();
+	}
+
+	size_t reclaim(size_t delay) {
+		return PoolAllocator<Type>::reclaim(delay);
+	}
+
+private:
+	size_t m_count = 0;
+};
+
+template<class Type>
+class HeapPool : public MemoryPool {
+public:
+	template<typename... Args>
+	Type *alloc(Args &&...args) {
+		static_assert(sizeof(Type) <= Heap::MAX_SLOT_SIZE, "type is too large for the heap size classes");
+		return new (Heap::instance().allocate(sizeof(Type))) Type(std::forward<Args>(args)...);
+	}
+
+	void free(Type *object) {
+		assert(object);
+		object->Type::~Type();
+		Heap::instance().deallocate(object);
+	}
+
+	void free(void *address) override {
+		assert(address);
+		Type *object = static_cast<Type *>(address);
+		object->Type::~Type();
+		Heap::instance().deallocate(object);
 	}
 };
 
@@ -32,6 +32,7 @@
 namespace mint {
 
 class SymbolTable;
+class MemberCache;
 class Cursor;
 
 MINT_EXPORT std::string type_name(const Reference &reference);
@@ -52,6 +53,7 @@ MINT_EXPORT void capture_all_symbols(Cursor *cursor);
 MINT_EXPORT void init_call(Cursor *cursor);
 MINT_EXPORT void init_call(Cursor *cursor, Reference &function);
 MINT_EXPORT void init_member_call(Cursor *cursor, const Symbol &member);
+MINT_EXPORT void init_member_call(Cursor *cursor, const Symbol &member, MemberCache *cache);
 MINT_EXPORT void init_operator_call(Cursor *cursor, Class::Operator op);
 MINT_EXPORT void exit_call(Cursor *cursor);
 MINT_EXPORT void init_exception(Cursor *cursor, const Symbol &symbol);
@@ -67,6 +69,8 @@ MINT_EXPORT void yield(Cursor *cursor, Reference &generator);
 MINT_EXPORT WeakReference get_symbol(SymbolTable *symbols, const Symbol &symbol);
 MINT_EXPORT WeakReference get_member(Cursor *cursor, const Reference &reference, const Symbol &member,
 									 Class **owner = nullptr);
+MINT_EXPORT WeakReference get_member(Cursor *cursor, const Reference &reference, const Symbol &member,
+									 MemberCache *cache, Class **owner = nullptr);
 MINT_EXPORT WeakReference get_operator(Cursor *cursor, const Reference &reference, Class::Operator op,
 									   Class **owner = nullptr);
 MINT_EXPORT void reduce_member(Cursor *cursor, Reference &&member);
@@ -31,6 +31,7 @@
 #include "mint/memory/memorypool.hpp"
 
 #include <unordered_map>
+#include <array>
 
 namespace mint {
 
@@ -39,7 +40,7 @@ class PackageData;
 
 struct MINT_EXPORT Number : public Data {
 	template<typename Type>
-	friend class LocalPool;
+	friend class HeapPool;
 	friend class GarbageCollector;
 public:
 	Number() = delete;
@@ -56,12 +57,12 @@ protected:
 	~Number() override = default;
 
 private:
-	static LocalPool<Number> g_pool;
+	static HeapPool<Number> g_pool;
 };
 
 struct MINT_EXPORT Boolean : public Data {
 	template<typename Type>
-	friend class LocalPool;
+	friend class HeapPool;
 	friend class GarbageCollector;
 public:
 	Boolean() = delete;
@@ -78,12 +79,12 @@ protected:
 	~Boolean() override = default;
 
 private:
-	static LocalPool<Boolean> g_pool;
+	static HeapPool<Boolean> g_pool;
 };
 
 struct MINT_EXPORT Object : public Data {
 	template<typename Type>
-	friend class LocalPool;
+	friend class HeapPool;
 	friend class GarbageCollector;
 public:
 	Object(Object &&) = delete;
@@ -98,8 +99,6 @@ public:
 	void construct();
 	void construct(const Object &other);
 
-	void mark() override;
-
 protected:
 	explicit Object(Class *type);
 	~Object() override;
@@ -107,12 +106,12 @@ protected:
 private:
 	void construct(const Object &other, std::unordered_map<const Data *, Data *> &memory_map);
 
-	static LocalPool<Object> g_pool;
+	static HeapPool<Object> g_pool;
 };
 
 struct MINT_EXPORT Package : public Data {
 	template<typename Type>
-	friend class LocalPool;
+	friend class HeapPool;
 	friend class GarbageCollector;
 public:
 	PackageData *const data;
@@ -121,12 +120,12 @@ protected:
 	explicit Package(PackageData *package);
 
 private:
-	static LocalPool<Package> g_pool;
+	static HeapPool<Package> g_pool;
 };
 
 struct MINT_EXPORT Function : public Data {
 	template<typename Type>
-	friend class LocalPool;
+	friend class HeapPool;
 	friend class GarbageCollector;
 public:
 	using Capture = SymbolMapping<WeakReference>;
@@ -149,6 +148,8 @@ public:
 		using iterator = std::map<int, Signature>::iterator;
 		using const_iterator = std::map<int, Signature>::const_iterator;
 
+		static constexpr const int FLAT_SIGNATURE_COUNT = 16;
+
 		Mapping();
 		Mapping(Mapping &&other) noexcept;
 		Mapping(const Mapping &other);
@@ -165,6 +166,7 @@ public:
 
 		[[nodiscard]] iterator lower_bound(int signature) const;
 		[[nodiscard]] iterator find(int signature) const;
+		[[nodiscard]] iterator resolve(int signature) const;
 
 		[[nodiscard]] const_iterator cbegin() const;
 		[[nodiscard]] const_iterator begin() const;
@@ -179,6 +181,8 @@ public:
 	private:
 		struct SharedData {
 			std::map<int, Signature> signatures;
+			std::array<iterator, FLAT_SIGNATURE_COUNT> resolved;
+			std::uint32_t resolved_mask = 0;
 			size_t refcount = 1;
 			bool sharable = true;
 
@@ -216,15 +220,13 @@ public:
 
 	Mapping mapping;
 
-	void mark() override;
-
 protected:
 	Function();
 	Function(const Function &other);
 	~Function() override = default;
 
 private:
-	static LocalPool<Function> g_pool;
+	static HeapPool<Function> g_pool;
 };
 
 }
@@ -54,14 +54,18 @@ public:
 
 	using Flags = std::underlying_type_t<Flag>;
 
+	/*
+	 * The references sharing the same variable share the same info. The
+	 * reference itself is only a pointer to it, the refcount and the flags
+	 * are packed with the data pointer in two words.
+	 */
 	struct Info {
-		Flags flags = DEFAULT;
 		Data *data = nullptr;
-		size_t refcount = 0;
+		std::uint32_t refcount = 0;
+		Flags flags = DEFAULT;
 	};
 
 	Reference(const Reference &) = delete;
-	virtual ~Reference();
 
 	Reference &operator=(Reference &&other) noexcept;
 	Reference &operator=(const Reference &) = delete;
@@ -77,9 +81,10 @@ public:
 	Info *info();
 
 protected:
-	explicit Reference(Flags flags = DEFAULT, Data *data = nullptr);
-	explicit Reference(Reference &&other) noexcept;
-	explicit Reference(Info *infos) noexcept;
+	explicit inline Reference(Flags flags = DEFAULT, Data *data = nullptr);
+	explicit inline Reference(Reference &&other) noexcept;
+	explicit inline Reference(Info *infos) noexcept;
+	inline ~Reference();
 
 	static GarbageCollector &g_garbage_collector;
 	static LocalPool<Info> g_pool;
@@ -92,13 +97,13 @@ private:
 
 class MINT_EXPORT WeakReference final : public Reference {
 public:
-	WeakReference(Flags flags = DEFAULT, Data *data = nullptr);
-	WeakReference(WeakReference &&other) noexcept;
+	inline WeakReference(Flags flags = DEFAULT, Data *data = nullptr);
+	inline WeakReference(WeakReference &&other) noexcept;
 	WeakReference(const WeakReference &) = delete;
-	WeakReference(Reference &&other) noexcept;
-	~WeakReference() override;
+	inline WeakReference(Reference &&other) noexcept;
+	~WeakReference() = default;
 
-	WeakReference &operator=(WeakReference &&other) noexcept;
+	inline WeakReference &operator=(WeakReference &&other) noexcept;
 	WeakReference &operator=(const WeakReference &) = delete;
 
 	template<class Type, typename... Args>
@@ -110,7 +115,7 @@ public:
 	static inline WeakReference clone(const Reference &other);
 
 protected:
-	explicit WeakReference(Info *infos);
+	inline explicit WeakReference(Info *infos);
 };
 
 class MINT_EXPORT StrongReference final : public Reference, public MemoryRoot {
@@ -138,6 +143,38 @@ protected:
 	explicit StrongReference(Info *infos);
 };
 
+Reference::Reference(Flags flags, Data *data) :
+	m_info(g_pool.alloc()) {
+	m_info->flags = flags;
+	g_garbage_collector.use(m_info->data = data ? data : g_garbage_collector.alloc<None>());
+	m_info->refcount = 1;
+	assert(m_info->data);
+}
+
+Reference::Reference(Reference &&other) noexcept :
+	m_info(other.m_info) {
+	++m_info->refcount;
+	assert(m_info->data);
+}
+
+Reference::Reference(Info *infos) noexcept :
+	m_info(infos) {
+	++m_info->refcount;
+	assert(m_info->data);
+}
+
+Reference::~Reference() {
+	assert(m_info);
+	if (!--m_info->refcount) {
+		assert(m_info->data);
+		g_garbage_collector.release(m_info->data);
+		g_pool.free(m_info);
+	}
+	else {
+		g_garbage_collector.barrier(m_info->data);
+	}
+}
+
 template<class Type, typename>
 Type *Reference::data() const {
 	return static_cast<Type *>(m_info->data);
@@ -147,6 +184,23 @@ Reference::Flags Reference::flags() const {
 	return m_info->flags;
 }
 
+WeakReference::WeakReference(Flags flags, Data *data) :
+	Reference(flags, data) {}
+
+WeakReference::WeakReference(WeakReference &&other) noexcept :
+	Reference(std::forward<WeakReference>(other)) {}
+
+WeakReference::WeakReference(Reference &&other) noexcept :
+	Reference(std::move(other)) {}
+
+WeakReference::WeakReference(Info *infos) :
+	Reference(infos) {}
+
+WeakReference &WeakReference::operator=(WeakReference &&other) noexcept {
+	Reference::operator=(std::forward<WeakReference>(other));
+	return *this;
+}
+
 template<class Type, typename... Args>
 WeakReference WeakReference::create(Args &&...args) {
 	return WeakReference(CONST_ADDRESS | CONST_VALUE | TEMPORARY,
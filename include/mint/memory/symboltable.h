@@ -30,6 +30,7 @@
 
 #include <vector>
 #include <memory>
+#include <optional>
 
 namespace mint {
 
@@ -47,6 +48,8 @@ public:
 	using iterator = SymbolMapping<WeakReference>::iterator;
 	using const_iterator = SymbolMapping<WeakReference>::const_iterator;
 
+	using fast_type = std::optional<WeakReference>;
+
 	explicit SymbolTable(Class *metadata = nullptr);
 	SymbolTable(SymbolTable &&) = delete;
 	SymbolTable(const SymbolTable &) = delete;
@@ -62,6 +65,7 @@ public:
 	inline void close_package();
 
 	inline void reserve_fast(size_t count);
+	inline void reserve_fast(fast_type *fasts, size_t count);
 	inline WeakReference &setup_fast(const Symbol &name, size_t index, Reference::Flags flags = Reference::DEFAULT);
 	inline WeakReference get_fast(const Symbol &name, size_t index);
 	inline size_t erase_fast(const Symbol &name, size_t index);
@@ -98,9 +102,13 @@ private:
 	WeakReference &create_fast_reference(const Symbol &name, size_t index);
 	WeakReference &create_fast_reference(Reference::Flags flags, const Symbol &name, size_t index);
 
+	void release_fast();
+
 	Class *m_metadata;
 	std::vector<PackageData *> m_package;
-	std::unique_ptr<WeakReference> *m_fasts;
+	fast_type *m_fasts = nullptr;
+	size_t m_fast_count = 0;
+	bool m_owns_fasts = false;
 	SymbolMapping<WeakReference> m_symbols;
 };
 
@@ -114,17 +122,29 @@ void SymbolTable::close_package() {
 }
 
 void SymbolTable::reserve_fast(size_t count) {
-	m_fasts = new std::unique_ptr<WeakReference>[count];
+	assert(m_fasts == nullptr);
+	m_fasts = new fast_type[count];
+	m_fast_count = count;
+	m_owns_fasts = true;
+}
+
+void SymbolTable::reserve_fast(fast_type *fasts, size_t count) {
+	// the slots are stored in the frame of the call, they stay empty until the
+	// first access to the symbol
+	assert(m_fasts == nullptr);
+	std::uninitialized_value_construct_n(fasts, count);
+	m_fasts = fasts;
+	m_fast_count = count;
 }
 
 WeakReference &SymbolTable::setup_fast(const Symbol &name, size_t index, Reference::Flags flags) {
-	assert(m_fasts[index] == nullptr || m_fasts[index]->data()->format == Data::FMT_NONE);
+	assert(!m_fasts[index].has_value() || m_fasts[index]->data()->format == Data::FMT_NONE);
 	return create_fast_reference(flags, name, index);
 }
 
 WeakReference SymbolTable::get_fast(const Symbol &name, size_t index) {
 
-	if (std::unique_ptr<WeakReference> &reference = m_fasts[index]) {
+	if (fast_type &reference = m_fasts[index]) {
 		return WeakReference::share(*reference);
 	}
 
@@ -132,7 +152,6 @@ WeakReference SymbolTable::get_fast(const Symbol &name, size_t index) {
 }
 
 size_t SymbolTable::erase_fast(const Symbol &name, size_t index) {
-	// assert(m_fasts[index] != nullptr);
 	m_fasts[index].reset();
 	return erase(name);
 }
@@ -207,8 +226,7 @@ SymbolTable::iterator SymbolTable::erase(iterator position) {
 
 void SymbolTable::clear() {
 	m_symbols.clear();
-	delete[] m_fasts;
-	m_fasts = nullptr;
+	release_fast();
 }
 
 }
@@ -26,12 +26,22 @@
 
 #include "mint/config.h"
 
+#include <chrono>
+#include <cstdint>
+
 namespace mint {
 
 class Cursor;
 class CursorDebugger;
 class DebugInterface;
 
+struct ProcessorLockStatistics {
+	std::uint64_t acquisitions;
+	std::uint64_t contentions;
+	std::uint64_t handoffs;
+	std::chrono::nanoseconds wait_time;
+};
+
 MINT_EXPORT bool debug_steps(CursorDebugger *cursor, DebugInterface *handle);
 MINT_EXPORT bool run_steps(Cursor *cursor);
 MINT_EXPORT bool run_step(Cursor *cursor);
@@ -39,6 +49,7 @@ MINT_EXPORT bool run_step(Cursor *cursor);
 MINT_EXPORT void set_multi_thread(bool enabled);
 MINT_EXPORT void lock_processor();
 MINT_EXPORT void unlock_processor();
+MINT_EXPORT ProcessorLockStatistics processor_lock_statistics();
 
 }
 
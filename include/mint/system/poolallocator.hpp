@@ -30,6 +30,8 @@
 #include <cstdint>
 #include <cstddef>
 #include <cstdlib>
+#include <functional>
+#include <vector>
 
 namespace mint {
 
@@ -55,14 +57,27 @@ struct PoolAllocator {
 												  : +std::alignment_of_v<pointer>;
 	static constexpr const size_t ALIGNED_SIZE = ((sizeof(value_type) - 1) / ALIGNMENT + 1) * ALIGNMENT;
 
+	/*
+	 * The header at the beginning of each chunk links the chunks of the pool
+	 * and keeps the number of items of the chunk, so a chunk can be released
+	 * once all its items are back in the free list.
+	 */
+	struct Chunk {
+		Chunk *next;
+		size_t capacity;
+		size_t idle_collections;
+	};
+
+	static constexpr const size_t HEADER_SIZE = ((sizeof(Chunk) - 1) / ALIGNMENT + 1) * ALIGNMENT;
+
 	PoolAllocator() = default;
 
 	PoolAllocator(const PoolAllocator &other) = delete;
 
 	PoolAllocator(PoolAllocator &&other) noexcept :
 		m_head(other.m_head),
-		m_free_list(other.m_free_list) {
-		other.m_free_list = nullptr;
+		m_chunks(other.m_chunks) {
+		other.m_chunks = nullptr;
 		other.m_head = nullptr;
 	}
 
@@ -75,16 +90,16 @@ struct PoolAllocator {
 	PoolAllocator &operator=(PoolAllocator &&other) noexcept {
 		reset();
 		m_head = other.m_head;
-		m_free_list = other.m_free_list;
+		m_chunks = other.m_chunks;
 		m_next_to_allocate = other.m_next_to_allocate;
-		other.m_free_list = nullptr;
+		other.m_chunks = nullptr;
 		other.m_head = nullptr;
 		return *this;
 	}
 
 	void swap(PoolAllocator &other) noexcept {
 		std::swap(m_head, other.m_head);
-		std::swap(m_free_list, other.m_free_list);
+		std::swap(m_chunks, other.m_chunks);
 	}
 
 	bool operator==(const PoolAllocator &other) {
@@ -101,7 +116,7 @@ struct PoolAllocator {
 
 		if (UNLIKELY(item == nullptr)) {
 			m_next_to_allocate = std::min(m_next_to_allocate * 2, MAX_SIZE);
-			const size_t bytes = ALIGNMENT + (ALIGNED_SIZE * m_next_to_allocate);
+			const size_t bytes = HEADER_SIZE + (ALIGNED_SIZE * m_next_to_allocate);
 			add(assert_not_null<std::bad_alloc>(std::malloc(bytes)), bytes);
 			item = m_head;
 		}
@@ -131,7 +146,7 @@ struct PoolAllocator {
 		}
 
 		if (available < size) {
-			const size_t bytes = ALIGNMENT + (ALIGNED_SIZE * size);
+			const size_t bytes = HEADER_SIZE + (ALIGNED_SIZE * size);
 			item = add_array(assert_not_null<std::bad_alloc>(std::malloc(bytes)), bytes);
 		}
 		else if (prev) {
@@ -162,12 +177,93 @@ struct PoolAllocator {
 		}
 	}
 
+	[[nodiscard]] size_t chunk_count() const {
+		size_t count = 0;
+		for (Chunk *chunk = m_chunks; chunk; chunk = chunk->next) {
+			++count;
+		}
+		return count;
+	}
+
+	/*
+	 * Releases the chunks whose items have all been free for more than delay
+	 * calls and returns the number of bytes given back to the system. The
+	 * free items are counted per chunk here rather than on each deallocation
+	 * to keep the allocation paths unchanged.
+	 */
+	size_t reclaim(size_t delay) {
+
+		if (m_chunks == nullptr) {
+			return 0;
+		}
+
+		std::vector<Chunk *> chunks;
+		for (Chunk *chunk = m_chunks; chunk; chunk = chunk->next) {
+			chunks.push_back(chunk);
+		}
+		std::sort(chunks.begin(), chunks.end(), std::less<Chunk *>());
+
+		const auto chunk_of = [&chunks](value_type *item) {
+			auto chunk = std::upper_bound(chunks.begin(), chunks.end(), reinterpret_cast<Chunk *>(item), std::less<Chunk *>());
+			assert(chunk != chunks.begin());
+			return static_cast<size_t>(std::distance(chunks.begin(), chunk) - 1);
+		};
+
+		std::vector<size_t> free_items(chunks.size(), 0);
+		for (value_type *item = m_head; item; item = *reinterpret_cast<value_type **>(item)) {
+			++free_items[chunk_of(item)];
+		}
+
+		std::vector<bool> released(chunks.size(), false);
+		bool any_released = false;
+		for (size_t i = 0; i < chunks.size(); ++i) {
+			if (free_items[i] < chunks[i]->capacity) {
+				chunks[i]->idle_collections = 0;
+			}
+			else if (++chunks[i]->idle_collections > delay) {
+				released[i] = any_released = true;
+			}
+		}
+
+		if (!any_released) {
+			return 0;
+		}
+
+		// the items of the released chunks are unlinked from the free list
+		value_type **tail = &m_head;
+		for (value_type *item = m_head; item; item = *reinterpret_cast<value_type **>(item)) {
+			if (!released[chunk_of(item)]) {
+				*tail = item;
+				tail = reinterpret_cast<value_type **>(item);
+			}
+		}
+		*tail = nullptr;
+
+		size_t reclaimed = 0;
+		m_chunks = nullptr;
+		m_next_to_allocate = MIN_SIZE;
+		for (size_t i = 0; i < chunks.size(); ++i) {
+			if (released[i]) {
+				reclaimed += HEADER_SIZE + ALIGNED_SIZE * chunks[i]->capacity;
+				std::free(chunks[i]);
+			}
+			else {
+				// the next chunks grow again from the size of the remaining ones
+				m_next_to_allocate = std::max(m_next_to_allocate, std::min(chunks[i]->capacity, MAX_SIZE));
+				chunks[i]->next = m_chunks;
+				m_chunks = chunks[i];
+			}
+		}
+
+		return reclaimed;
+	}
+
 	void reset() {
 
-		while (m_free_list) {
-			value_type *item = *m_free_list;
-			std::free(m_free_list);
-			m_free_list = reinterpret_cast<value_type **>(item);
+		while (m_chunks) {
+			Chunk *next = m_chunks->next;
+			std::free(m_chunks);
+			m_chunks = next;
 		}
 
 		m_head = nullptr;
@@ -176,16 +272,16 @@ struct PoolAllocator {
 protected:
 	void add(void *address, const size_type size) {
 
-		assert(size >= ALIGNMENT);
-
-		const size_t count = (size - ALIGNMENT) / ALIGNED_SIZE;
-		auto **data = reinterpret_cast<value_type **>(address);
+		assert(size >= HEADER_SIZE + ALIGNED_SIZE);
 
-		auto ***x = reinterpret_cast<value_type ***>(data);
-		*x = m_free_list;
-		m_free_list = data;
+		const size_t count = (size - HEADER_SIZE) / ALIGNED_SIZE;
+		auto *chunk = static_cast<Chunk *>(address);
+		chunk->next = m_chunks;
+		chunk->capacity = count;
+		chunk->idle_collections = 0;
+		m_chunks = chunk;
 
-		auto *const head_item = reinterpret_cast<value_type *>(reinterpret_cast<uint8_t *>(address) + ALIGNMENT);
+		auto *const head_item = reinterpret_cast<value_type *>(reinterpret_cast<uint8_t *>(address) + HEADER_SIZE);
 		auto *const head_data = reinterpret_cast<uint8_t *>(head_item);
 
 		for (size_t i = 0; i < count; ++i) {
@@ -198,20 +294,20 @@ protected:
 
 	value_type *add_array(void *address, const size_type size) {
 
-		assert(size >= ALIGNMENT);
-
-		auto **data = reinterpret_cast<value_type **>(address);
+		assert(size >= HEADER_SIZE);
 
-		auto ***x = reinterpret_cast<value_type ***>(data);
-		*x = m_free_list;
-		m_free_list = data;
+		auto *chunk = static_cast<Chunk *>(address);
+		chunk->next = m_chunks;
+		chunk->capacity = (size - HEADER_SIZE) / ALIGNED_SIZE;
+		chunk->idle_collections = 0;
+		m_chunks = chunk;
 
-		return reinterpret_cast<value_type *>(reinterpret_cast<uint8_t *>(address) + ALIGNMENT);
+		return reinterpret_cast<value_type *>(reinterpret_cast<uint8_t *>(address) + HEADER_SIZE);
 	}
 
 private:
 	value_type *m_head = nullptr;
-	value_type **m_free_list = nullptr;
+	Chunk *m_chunks = nullptr;
 	size_t m_next_to_allocate = MIN_SIZE;
 };
 
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2025 Gauvain CHERY.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef MINT_STACKALLOCATOR_HPP
+#define MINT_STACKALLOCATOR_HPP
+
+#include "mint/config.h"
+#include "mint/system/assert.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace mint {
+
+/*
+ * Allocates memory by moving a pointer in blocks that are kept for the next
+ * allocations. The memory must be released in the reverse order of the
+ * allocations.
+ */
+class StackAllocator {
+public:
+	static constexpr const size_t BLOCK_SIZE = 0x10000;
+	static constexpr const size_t ALIGNMENT = alignof(std::max_align_t);
+
+	StackAllocator() = default;
+	StackAllocator(StackAllocator &&other) = delete;
+	StackAllocator(const StackAllocator &other) = delete;
+
+	~StackAllocator() {
+		for (const Block &block : m_blocks) {
+			std::free(block.begin);
+		}
+	}
+
+	StackAllocator &operator=(StackAllocator &&other) = delete;
+	StackAllocator &operator=(const StackAllocator &other) = delete;
+
+	void *allocate(size_t size) {
+
+		assert(size > 0);
+		size = ((size - 1) / ALIGNMENT + 1) * ALIGNMENT;
+
+		if (UNLIKELY(static_cast<size_t>(m_end - m_top) < size)) {
+			next_block(size);
+		}
+
+		void *address = m_top;
+		m_top += size;
+		return address;
+	}
+
+	void deallocate(void *address) {
+
+		auto *top = static_cast<byte_t *>(address);
+
+		while (top < m_blocks[m_depth - 1].begin || top >= m_blocks[m_depth - 1].end) {
+			--m_depth;
+		}
+
+		m_top = top;
+		m_end = m_blocks[m_depth - 1].end;
+	}
+
+private:
+	struct Block {
+		byte_t *begin;
+		byte_t *end;
+	};
+
+	void next_block(size_t size) {
+
+		while (m_depth < m_blocks.size() && static_cast<size_t>(m_blocks[m_depth].end - m_blocks[m_depth].begin) < size) {
+			std::free(m_blocks[m_depth].begin);
+			m_blocks.erase(std::next(m_blocks.begin(), static_cast<std::ptrdiff_t>(m_depth)));
+		}
+
+		if (m_depth == m_blocks.size()) {
+			const size_t capacity = std::max(size, BLOCK_SIZE);
+			auto *begin = static_cast<byte_t *>(assert_not_null<std::bad_alloc>(std::malloc(capacity)));
+			m_blocks.insert(std::next(m_blocks.begin(), static_cast<std::ptrdiff_t>(m_depth)), {begin, begin + capacity});
+		}
+
+		m_top = m_blocks[m_depth].begin;
+		m_end = m_blocks[m_depth].end;
+		++m_depth;
+	}
+
+	std::vector<Block> m_blocks;
+	size_t m_depth = 0;
+	byte_t *m_top = nullptr;
+	byte_t *m_end = nullptr;
+};
+
+}
+
+#endif // MINT_STACKALLOCATOR_HPP
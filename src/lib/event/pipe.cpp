@@ -144,8 +144,13 @@ MINT_FUNCTION(mint_pipe_wait, 2, cursor) {
 		dwMilliseconds = static_cast<DWORD>(to_integer(cursor, timeout));
 	}
 
-	DWORD ret = WaitForSingleObjectEx(h, dwMilliseconds, true);
-	helper.return_value(create_boolean(ret == WAIT_OBJECT_0));
+	bool result = false;
+
+	if (auto region = helper.blocking_region(); WaitForSingleObjectEx(h, dwMilliseconds, true) == WAIT_OBJECT_0) {
+		result = true;
+	}
+
+	helper.return_value(create_boolean(result));
 #else
 	pollfd fds;
 	fds.events = POLLIN;
@@ -158,9 +163,8 @@ MINT_FUNCTION(mint_pipe_wait, 2, cursor) {
 	}
 
 	bool result = false;
-	int ret = poll(&fds, 1, time_ms);
 
-	if ((ret > 0) && (fds.revents & POLLIN)) {
+	if (auto region = helper.blocking_region(); (poll(&fds, 1, time_ms) > 0) && (fds.revents & POLLIN)) {
 		result = true;
 	}
 
@@ -261,13 +265,15 @@ MINT_FUNCTION(mint_system_pipe_write, 2, cursor) {
 	FunctionHelper helper(cursor, 2);
 	const Reference &stream = helper.pop_parameter();
 	mint::handle_t handle = to_handle(helper.pop_parameter());
-	std::vector<uint8_t> *buffer = stream.data<LibObject<std::vector<uint8_t>>>()->impl;
+	// the buffer can be modified by other threads once the lock is released
+	const std::vector<uint8_t> buffer(*stream.data<LibObject<std::vector<uint8_t>>>()->impl);
+	auto region = helper.blocking_region();
 
 #ifdef OS_WINDOWS
 	DWORD dwCount;
-	WriteFile(handle, buffer->data(), buffer->size(), &dwCount, nullptr);
+	WriteFile(handle, buffer.data(), buffer.size(), &dwCount, nullptr);
 #else
-	write(handle, buffer->data(), buffer->size());
+	write(handle, buffer.data(), buffer.size());
 #endif
 }
 
@@ -284,8 +290,13 @@ MINT_FUNCTION(mint_system_pipe_wait, 2, cursor) {
 		dwMilliseconds = static_cast<DWORD>(to_integer(cursor, timeout));
 	}
 
-	DWORD ret = WaitForSingleObjectEx(h, dwMilliseconds, true);
-	helper.return_value(create_boolean(ret == WAIT_OBJECT_0));
+	bool result = false;
+
+	if (auto region = helper.blocking_region(); WaitForSingleObjectEx(h, dwMilliseconds, true) == WAIT_OBJECT_0) {
+		result = true;
+	}
+
+	helper.return_value(create_boolean(result));
 #else
 	pollfd fds;
 	fds.events = POLLIN;
@@ -298,9 +309,8 @@ MINT_FUNCTION(mint_system_pipe_wait, 2, cursor) {
 	}
 
 	bool result = false;
-	int ret = poll(&fds, 1, time_ms);
 
-	if ((ret > 0) && (fds.revents & POLLIN)) {
+	if (auto region = helper.blocking_region(); (poll(&fds, 1, time_ms) > 0) && (fds.revents & POLLIN)) {
 		result = true;
 	}
 
@@ -233,7 +233,7 @@ MINT_FUNCTION(mint_timer_wait, 2, cursor) {
 
 	bool result = false;
 
-	if (WaitForSingleObject(handle, time_ms) == WAIT_OBJECT_0) {
+	if (auto region = helper.blocking_region(); WaitForSingleObject(handle, time_ms) == WAIT_OBJECT_0) {
 		ResetEvent(handle);
 		result = true;
 	}
@@ -251,9 +251,8 @@ MINT_FUNCTION(mint_timer_wait, 2, cursor) {
 	}
 
 	bool result = false;
-	int ret = poll(&fds, 1, time_ms);
 
-	if ((ret > 0) && (fds.revents & POLLIN)) {
+	if (auto region = helper.blocking_region(); (poll(&fds, 1, time_ms) > 0) && (fds.revents & POLLIN)) {
 		uint64_t value = 0;
 		read(fds.fd, &value, sizeof(value));
 		result = value != 0;
@@ -61,10 +61,14 @@ MINT_FUNCTION(mint_watcher_poll, 2, cursor) {
 		time_ms = static_cast<int>(to_integer(cursor, timeout));
 	}
 
-	DWORD status = WaitForMultipleObjectsEx(fdset.size(), fdset.data(), false, time_ms, true);
-
-	while (status == WAIT_IO_COMPLETION) {
-		status = WaitForMultipleObjectsEx(fdset.size(), fdset.data(), false, 0, true);
+	DWORD status = WAIT_FAILED;
+
+	{
+		auto region = helper.blocking_region(event_set);
+		status = WaitForMultipleObjectsEx(fdset.size(), fdset.data(), false, time_ms, true);
+		while (status == WAIT_IO_COMPLETION) {
+			status = WaitForMultipleObjectsEx(fdset.size(), fdset.data(), false, 0, true);
+		}
 	}
 
 	for (size_t i = status - WAIT_OBJECT_0 + 1; i < fdset.size(); ++i) {
@@ -88,7 +92,10 @@ MINT_FUNCTION(mint_watcher_poll, 2, cursor) {
 		time_ms = static_cast<int>(to_integer(cursor, timeout));
 	}
 
-	poll(fdset.data(), fdset.size(), time_ms);
+	{
+		auto region = helper.blocking_region(event_set);
+		poll(fdset.data(), fdset.size(), time_ms);
+	}
 
 	for (size_t i = 0; i < fdset.size(); ++i) {
 		get_member_ignore_visibility(event_set.at(i), symbols::activated).data<Boolean>()->value = fdset.at(i).revents
@@ -23,6 +23,10 @@
 
 #include <mint/memory/garbagecollector.h>
 #include <mint/memory/functiontool.h>
+#include <mint/memory/casttool.h>
+#include <mint/memory/builtin/hash.h>
+
+#include <chrono>
 
 using namespace mint;
 
@@ -30,3 +34,99 @@ MINT_FUNCTION(mint_garbage_collector_collect, 0, cursor) {
 	FunctionHelper helper(cursor, 0);
 	helper.return_value(create_number(static_cast<double>(GarbageCollector::instance().collect())));
 }
+
+static WeakReference create_data_statistics(const GarbageCollectorStatistics::DataStatistics &statistics) {
+
+	WeakReference result = create_hash();
+
+	hash_insert(result.data<Hash>(), create_string("liveObjects"), create_number(static_cast<double>(statistics.live_objects)));
+	hash_insert(result.data<Hash>(), create_string("liveBytes"), create_number(static_cast<double>(statistics.live_bytes)));
+	hash_insert(result.data<Hash>(), create_string("markedObjects"), create_number(static_cast<double>(statistics.marked_objects)));
+	hash_insert(result.data<Hash>(), create_string("markedBytes"), create_number(static_cast<double>(statistics.marked_bytes)));
+	hash_insert(result.data<Hash>(), create_string("sweptObjects"), create_number(static_cast<double>(statistics.swept_objects)));
+	hash_insert(result.data<Hash>(), create_string("sweptBytes"), create_number(static_cast<double>(statistics.swept_bytes)));
+
+	return result;
+}
+
+MINT_FUNCTION(mint_garbage_collector_statistics, 0, cursor) {
+
+	FunctionHelper helper(cursor, 0);
+	const GarbageCollectorStatistics statistics = GarbageCollector::instance().statistics();
+	WeakReference result = create_hash();
+
+	static constexpr const std::array<const char *, GarbageCollectorStatistics::FORMAT_COUNT> g_formats = {
+		"none", "null", "number", "boolean", "object", "package", "function",
+	};
+
+	static constexpr const std::array<const char *, GarbageCollectorStatistics::METATYPE_COUNT> g_metatypes = {
+		"object", "string", "regex", "array", "hash", "iterator", "library", "libobject",
+	};
+
+	const auto milliseconds = [](std::chrono::nanoseconds duration) {
+		return create_number(std::chrono::duration<double, std::milli>(duration).count());
+	};
+
+	hash_insert(result.data<Hash>(), create_string("youngCollections"), create_number(static_cast<double>(statistics.young_collections)));
+	hash_insert(result.data<Hash>(), create_string("fullCollections"), create_number(static_cast<double>(statistics.full_collections)));
+	hash_insert(result.data<Hash>(), create_string("pauses"), create_number(static_cast<double>(statistics.pauses)));
+	hash_insert(result.data<Hash>(), create_string("pauseTime"), milliseconds(statistics.pause_time));
+	hash_insert(result.data<Hash>(), create_string("maxPauseTime"), milliseconds(statistics.max_pause_time));
+	hash_insert(result.data<Hash>(), create_string("lastPauseTime"), milliseconds(statistics.last_pause_time));
+	hash_insert(result.data<Hash>(), create_string("youngObjects"), create_number(static_cast<double>(statistics.young_objects)));
+	hash_insert(result.data<Hash>(), create_string("oldObjects"), create_number(static_cast<double>(statistics.old_objects)));
+	hash_insert(result.data<Hash>(), create_string("roots"), create_number(static_cast<double>(statistics.roots)));
+	hash_insert(result.data<Hash>(), create_string("stacks"), create_number(static_cast<double>(statistics.stacks)));
+	hash_insert(result.data<Hash>(), create_string("heapPages"), create_number(static_cast<double>(statistics.heap_pages)));
+	hash_insert(result.data<Hash>(), create_string("heapBytes"), create_number(static_cast<double>(statistics.heap_bytes)));
+	hash_insert(result.data<Hash>(), create_string("referenceInfos"), create_number(static_cast<double>(statistics.reference_infos)));
+	hash_insert(result.data<Hash>(), create_string("referenceInfoChunks"), create_number(static_cast<double>(statistics.reference_info_chunks)));
+	hash_insert(result.data<Hash>(), create_string("reclaimedBytes"), create_number(static_cast<double>(statistics.reclaimed_bytes)));
+
+	WeakReference formats = create_hash();
+	for (size_t format = 0; format < GarbageCollectorStatistics::FORMAT_COUNT; ++format) {
+		hash_insert(formats.data<Hash>(), create_string(g_formats[format]), create_data_statistics(statistics.formats[format]));
+	}
+	hash_insert(result.data<Hash>(), create_string("formats"), std::move(formats));
+
+	WeakReference metatypes = create_hash();
+	for (size_t metatype = 0; metatype < GarbageCollectorStatistics::METATYPE_COUNT; ++metatype) {
+		hash_insert(metatypes.data<Hash>(), create_string(g_metatypes[metatype]), create_data_statistics(statistics.metatypes[metatype]));
+	}
+	hash_insert(result.data<Hash>(), create_string("metatypes"), std::move(metatypes));
+
+	helper.return_value(std::move(result));
+}
+
+MINT_FUNCTION(mint_garbage_collector_start_heap_profiler, 1, cursor) {
+
+	FunctionHelper helper(cursor, 1);
+	Reference &sampling_interval = helper.pop_parameter();
+
+	if (sampling_interval.data()->format == Data::FMT_NONE) {
+		GarbageCollector::instance().start_heap_profiler();
+	}
+	else {
+		GarbageCollector::instance().start_heap_profiler(static_cast<size_t>(to_integer(cursor, sampling_interval)));
+	}
+}
+
+MINT_FUNCTION(mint_garbage_collector_stop_heap_profiler, 0, cursor) {
+	FunctionHelper helper(cursor, 0);
+	GarbageCollector::instance().stop_heap_profiler();
+}
+
+MINT_FUNCTION(mint_garbage_collector_dump_heap_profile, 2, cursor) {
+
+	FunctionHelper helper(cursor, 2);
+	Reference &profile = helper.pop_parameter();
+	Reference &path = helper.pop_parameter();
+
+	if (HeapProfiler *profiler = GarbageCollector::instance().heap_profiler()) {
+		helper.return_value(create_boolean(
+			profiler->dump(to_string(path), static_cast<HeapProfiler::Profile>(to_integer(cursor, profile)))));
+	}
+	else {
+		helper.return_value(create_boolean(false));
+	}
+}
@@ -24,6 +24,7 @@
 #include "mint/memory/functiontool.h"
 #include "mint/memory/globaldata.h"
 #include "mint/memory/casttool.h"
+#include "mint/memory/membercache.h"
 #include "mint/scheduler/scheduler.h"
 #include "mint/scheduler/processor.h"
 #include "mint/scheduler/process.h"
@@ -435,6 +436,7 @@ MINT_FUNCTION(mint_lang_create_object_global, 3, cursor) {
 					/*.value = */ WeakReference(Reference::GLOBAL | value.flags(), value.data()),
 				};
 				data->metadata->globals().emplace(symbol, member);
+				MemberCache::invalidate_all();
 				helper.return_value(create_boolean(true));
 			}
 			else {
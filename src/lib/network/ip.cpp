@@ -210,7 +210,13 @@ MINT_FUNCTION(mint_ip_socket_connect, 4, cursor) {
 
 	Scheduler::instance().set_socket_listening(socket_fd, false);
 
-	if (::connect(socket_fd, target.get(), length) == 0) {
+	const int status = helper.blocking_call(
+		[&] {
+			return ::connect(socket_fd, target.get(), length);
+		},
+		{result});
+
+	if (status == 0) {
 		iterator_yield(result.data<Iterator>(), IOStatus.member(symbols::IOSuccess));
 	}
 	else {
@@ -254,7 +260,11 @@ MINT_FUNCTION(mint_ip_socket_accept, 1, cursor) {
 	sockaddr cli_addr {};
 	socklen_t cli_len = sizeof(cli_addr);
 	const SOCKET socket_fd = to_integer(cursor, socket);
-	const SOCKET client_fd = ::accept(socket_fd, &cli_addr, &cli_len);
+	const SOCKET client_fd = helper.blocking_call(
+		[&] {
+			return ::accept(socket_fd, &cli_addr, &cli_len);
+		},
+		{result});
 
 	if (client_fd != INVALID_SOCKET) {
 
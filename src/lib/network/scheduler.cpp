@@ -103,8 +103,14 @@ MINT_FUNCTION(mint_scheduler_poll, 2, cursor) {
 					   return *fd.data<LibObject<PollFd>>()->impl;
 				   });
 
-	helper.return_value(
-		create_boolean(Scheduler::instance().poll(fdset, static_cast<int>(to_integer(cursor, timeout)))));
+	const int time_ms = static_cast<int>(to_integer(cursor, timeout));
+	const bool result = helper.blocking_call(
+		[&] {
+			return Scheduler::instance().poll(fdset, time_ms);
+		},
+		{handles});
+
+	helper.return_value(create_boolean(result));
 
 	size_t i = 0;
 
@@ -173,6 +179,10 @@ bool revents_from_native_handle(PollFd &desc, const native_handle_t &handle) {
 	desc.revents = 0;
 
 #ifdef OS_UNIX
+	if ((handle.revents & POLLNVAL) && !Scheduler::instance().is_socket_open(handle.fd)) {
+		// the socket was closed by another thread while the processor lock was released
+		return false;
+	}
 	if ((handle.revents & (POLLIN | POLLPRI)) && !Scheduler::instance().is_socket_listening(handle.fd)) {
 		desc.revents |= PollFd::READ_EVENT;
 	}
@@ -274,6 +284,7 @@ SOCKET Scheduler::open_socket(int domain, int type, int protocol) {
 	SOCKET fd = ::socket(domain, type, protocol);
 
 	if (fd != INVALID_SOCKET) {
+		std::unique_lock<std::mutex> lock(m_mutex);
 		m_sockets.emplace(fd, SocketInfo {false, true, false});
 	}
 
@@ -281,11 +292,14 @@ SOCKET Scheduler::open_socket(int domain, int type, int protocol) {
 }
 
 void Scheduler::accept_socket(SOCKET fd) {
+	std::unique_lock<std::mutex> lock(m_mutex);
 	m_sockets.emplace(fd, SocketInfo {false, true, false});
 }
 
 Scheduler::Error Scheduler::close_socket(SOCKET fd) {
+	std::unique_lock<std::mutex> lock(m_mutex);
 	m_sockets.erase(fd);
+	lock.unlock();
 #ifdef OS_UNIX
 	return close(fd) == 0;
 #else
@@ -293,8 +307,14 @@ Scheduler::Error Scheduler::close_socket(SOCKET fd) {
 #endif
 }
 
+bool Scheduler::is_socket_open(SOCKET fd) const {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	return m_sockets.find(fd) != m_sockets.end();
+}
+
 bool Scheduler::is_socket_listening(SOCKET fd) const {
 
+	std::unique_lock<std::mutex> lock(m_mutex);
 	auto i = m_sockets.find(fd);
 
 	if (i != m_sockets.end()) {
@@ -306,6 +326,7 @@ bool Scheduler::is_socket_listening(SOCKET fd) const {
 
 void Scheduler::set_socket_listening(SOCKET fd, bool listening) {
 
+	std::unique_lock<std::mutex> lock(m_mutex);
 	auto i = m_sockets.find(fd);
 
 	if (i != m_sockets.end()) {
@@ -315,6 +336,7 @@ void Scheduler::set_socket_listening(SOCKET fd, bool listening) {
 
 bool Scheduler::is_socket_blocking(SOCKET fd) const {
 
+	std::unique_lock<std::mutex> lock(m_mutex);
 	auto i = m_sockets.find(fd);
 
 	if (i != m_sockets.end()) {
@@ -326,6 +348,7 @@ bool Scheduler::is_socket_blocking(SOCKET fd) const {
 
 void Scheduler::set_socket_blocking(SOCKET fd, bool blocking) {
 
+	std::unique_lock<std::mutex> lock(m_mutex);
 	auto i = m_sockets.find(fd);
 
 	if (i != m_sockets.end()) {
@@ -335,6 +358,7 @@ void Scheduler::set_socket_blocking(SOCKET fd, bool blocking) {
 
 bool Scheduler::is_socket_blocked(SOCKET fd) const {
 
+	std::unique_lock<std::mutex> lock(m_mutex);
 	auto i = m_sockets.find(fd);
 
 	if (i != m_sockets.end()) {
@@ -346,6 +370,7 @@ bool Scheduler::is_socket_blocked(SOCKET fd) const {
 
 void Scheduler::set_socket_blocked(SOCKET fd, bool blocked) {
 
+	std::unique_lock<std::mutex> lock(m_mutex);
 	auto i = m_sockets.find(fd);
 
 	if (i != m_sockets.end()) {
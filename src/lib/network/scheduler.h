@@ -27,6 +27,7 @@
 #include <mint/config.h>
 #include <unordered_map>
 #include <cstdint>
+#include <mutex>
 #include <vector>
 
 #ifdef OS_WINDOWS
@@ -93,6 +94,8 @@ public:
 	void accept_socket(SOCKET fd);
 	Error close_socket(SOCKET fd);
 
+	[[nodiscard]] bool is_socket_open(SOCKET fd) const;
+
 	[[nodiscard]] bool is_socket_listening(SOCKET fd) const;
 	void set_socket_listening(SOCKET fd, bool listening);
 
@@ -114,6 +117,7 @@ private:
 		bool listening: 1;
 	};
 
+	mutable std::mutex m_mutex;
 	std::unordered_map<SOCKET, SocketInfo> m_sockets;
 };
 
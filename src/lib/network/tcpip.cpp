@@ -92,7 +92,13 @@ MINT_FUNCTION(mint_tcp_ip_socket_send, 2, cursor) {
 	int flags = MSG_NOSIGNAL;
 #endif
 
-	auto count = send(socket_fd, reinterpret_cast<const char *>(buf->data()), buf->size(), flags);
+	// the buffer can be modified by other threads once the lock is released
+	const std::vector<uint8_t> data(*buf);
+	auto count = helper.blocking_call(
+		[&] {
+			return send(socket_fd, reinterpret_cast<const char *>(data.data()), data.size(), flags);
+		},
+		{result});
 
 	switch (count) {
 	case -1:
@@ -144,7 +150,11 @@ MINT_FUNCTION(mint_tcp_ip_socket_recv, 2, cursor) {
 #endif
 
 		std::unique_ptr<uint8_t[]> local_buffer(new uint8_t[length]);
-		auto count = recv(socket_fd, reinterpret_cast<char *>(local_buffer.get()), static_cast<size_t>(length), 0);
+		auto count = helper.blocking_call(
+			[&] {
+				return recv(socket_fd, reinterpret_cast<char *>(local_buffer.get()), static_cast<size_t>(length), 0);
+			},
+			{buffer, result});
 
 		switch (count) {
 		case -1:
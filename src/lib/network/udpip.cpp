@@ -154,8 +154,14 @@ MINT_FUNCTION(mint_udp_ip_socket_sendto, 5, cursor) {
 	int flags = MSG_CONFIRM;
 #endif
 
-	auto count = sendto(socket_fd, reinterpret_cast<const char *>(buf->data()), buf->size(), flags, target.get(),
-						targetlen);
+	// the buffer can be modified by other threads once the lock is released
+	const std::vector<uint8_t> data(*buf);
+	auto count = helper.blocking_call(
+		[&] {
+			return sendto(socket_fd, reinterpret_cast<const char *>(data.data()), data.size(), flags, target.get(),
+						  targetlen);
+		},
+		{result});
 
 	switch (count) {
 	case -1:
@@ -213,8 +219,12 @@ MINT_FUNCTION(mint_udp_ip_socket_recvfrom, 2, cursor) {
 
 		int flags = 0; // MSG_WAITALL;
 		std::unique_ptr<uint8_t[]> local_buffer(new uint8_t[length]);
-		auto count = recvfrom(socket_fd, reinterpret_cast<char *>(local_buffer.get()), static_cast<size_t>(length),
-							  flags, &source, &sourcelen);
+		auto count = helper.blocking_call(
+			[&] {
+				return recvfrom(socket_fd, reinterpret_cast<char *>(local_buffer.get()), static_cast<size_t>(length),
+								flags, &source, &sourcelen);
+			},
+			{buffer, result});
 
 		switch (count) {
 		case -1:
@@ -283,7 +293,13 @@ MINT_FUNCTION(mint_udp_ip_socket_send, 2, cursor) {
 	int flags = MSG_CONFIRM;
 #endif
 
-	auto count = send(socket_fd, reinterpret_cast<const char *>(buf->data()), buf->size(), flags);
+	// the buffer can be modified by other threads once the lock is released
+	const std::vector<uint8_t> data(*buf);
+	auto count = helper.blocking_call(
+		[&] {
+			return send(socket_fd, reinterpret_cast<const char *>(data.data()), data.size(), flags);
+		},
+		{result});
 
 	switch (count) {
 	case -1:
@@ -336,7 +352,11 @@ MINT_FUNCTION(mint_udp_ip_socket_recv, 2, cursor) {
 
 		int flags = MSG_WAITALL;
 		std::unique_ptr<uint8_t[]> local_buffer(new uint8_t[length]);
-		auto count = recv(socket_fd, reinterpret_cast<char *>(local_buffer.get()), static_cast<size_t>(length), flags);
+		auto count = helper.blocking_call(
+			[&] {
+				return recv(socket_fd, reinterpret_cast<char *>(local_buffer.get()), static_cast<size_t>(length), flags);
+			},
+			{buffer, result});
 
 		switch (count) {
 		case -1:
@@ -518,14 +518,21 @@ MINT_FUNCTION(mint_file_fgetc, 1, cursor) {
 
 	const Reference &file = helper.pop_parameter();
 
-	int cptr = fgetc(file.data<LibObject<FILE>>()->impl);
+	FILE *stream = file.data<LibObject<FILE>>()->impl;
+	std::string result;
 
-	if (cptr != EOF) {
-		std::string result(1, static_cast<char>(cptr));
-		size_t length = utf8_code_point_length(static_cast<uint8_t>(cptr));
-		while (--length) {
-			result += static_cast<char>(fgetc(file.data<LibObject<FILE>>()->impl));
+	{
+		auto region = helper.blocking_region({file});
+		if (int cptr = fgetc(stream); cptr != EOF) {
+			result += static_cast<char>(cptr);
+			size_t length = utf8_code_point_length(static_cast<uint8_t>(cptr));
+			while (--length) {
+				result += static_cast<char>(fgetc(stream));
+			}
 		}
+	}
+
+	if (!result.empty()) {
 		helper.return_value(create_string(result));
 	}
 }
@@ -538,7 +545,13 @@ MINT_FUNCTION(mint_file_fgetw, 1, cursor) {
 
 	char *word = nullptr;
 
-	if (ssize_t read = fscanf(file.data<LibObject<FILE>>()->impl, "%ms", &word); read != EOF) {
+	const ssize_t read = helper.blocking_call(
+		[&] {
+			return fscanf(file.data<LibObject<FILE>>()->impl, "%ms", &word);
+		},
+		{file});
+
+	if (read != EOF) {
 		helper.return_value(create_string(std::string {word, static_cast<size_t>(read)}));
 		free(word);
 	}
@@ -553,7 +566,13 @@ MINT_FUNCTION(mint_file_readline, 1, cursor) {
 	size_t len = 0;
 	char *line = nullptr;
 
-	if (ssize_t read = getline(&line, &len, file.data<LibObject<FILE>>()->impl); read != EOF) {
+	const ssize_t read = helper.blocking_call(
+		[&] {
+			return getline(&line, &len, file.data<LibObject<FILE>>()->impl);
+		},
+		{file});
+
+	if (read != EOF) {
 		line[read - 1] = '\0';
 		helper.return_value(create_string(line));
 		free(line);
@@ -571,8 +590,11 @@ MINT_FUNCTION(mint_file_read, 1, cursor) {
 	size_t len = 0;
 	char *line = nullptr;
 
-	while ((read = getline(&line, &len, file.data<LibObject<FILE>>()->impl)) != EOF) {
-		result += line;
+	{
+		auto region = helper.blocking_region({file});
+		while ((read = getline(&line, &len, file.data<LibObject<FILE>>()->impl)) != EOF) {
+			result += line;
+		}
 	}
 
 	free(line);
@@ -589,7 +611,11 @@ MINT_FUNCTION(mint_file_fwrite, 2, cursor) {
 	FILE *stream = file.data<LibObject<FILE>>()->impl;
 	std::string str = to_string(value);
 
-	auto amount = fwrite(str.c_str(), sizeof(char), str.size(), stream);
+	auto amount = helper.blocking_call(
+		[&] {
+			return fwrite(str.c_str(), sizeof(char), str.size(), stream);
+		},
+		{file});
 
 	Reference &&result = create_iterator();
 	iterator_yield(result.data<Iterator>(), create_number(static_cast<double>(amount)));
@@ -605,7 +631,11 @@ MINT_FUNCTION(mint_file_read_byte, 2, cursor) {
 	const Reference &buffer = helper.pop_parameter();
 	const Reference &file = helper.pop_parameter();
 
-	int cptr = fgetc(file.data<LibObject<FILE>>()->impl);
+	int cptr = helper.blocking_call(
+		[&] {
+			return fgetc(file.data<LibObject<FILE>>()->impl);
+		},
+		{file});
 
 	if (cptr != EOF) {
 		buffer.data<LibObject<std::vector<uint8_t>>>()->impl->push_back(static_cast<uint8_t>(cptr));
@@ -624,13 +654,19 @@ MINT_FUNCTION(mint_file_read_binary, 2, cursor) {
 	const Reference &file = helper.pop_parameter();
 
 	uint8_t chunk[BUFSIZ];
+	std::vector<uint8_t> data;
 	std::vector<uint8_t> *bytearray = buffer.data<LibObject<std::vector<uint8_t>>>()->impl;
 
-	while (!feof(file.data<LibObject<FILE>>()->impl)) {
-		auto amount = fread(chunk, sizeof(uint8_t), sizeof(chunk), file.data<LibObject<FILE>>()->impl);
-		copy_n(chunk, amount, back_inserter(*bytearray));
+	{
+		auto region = helper.blocking_region({file});
+		while (!feof(file.data<LibObject<FILE>>()->impl)) {
+			auto amount = fread(chunk, sizeof(uint8_t), sizeof(chunk), file.data<LibObject<FILE>>()->impl);
+			copy_n(chunk, amount, back_inserter(data));
+		}
 	}
 
+	copy(data.begin(), data.end(), back_inserter(*bytearray));
+
 	helper.return_value(create_boolean(!bytearray->empty()));
 }
 
@@ -642,13 +678,19 @@ MINT_FUNCTION(mint_file_fwrite_binary, 2, cursor) {
 	Reference &file = helper.pop_parameter();
 
 	FILE *stream = file.data<LibObject<FILE>>()->impl;
-	std::vector<uint8_t> *bytearray = buffer.data<LibObject<std::vector<uint8_t>>>()->impl;
 
-	auto amount = fwrite(bytearray->data(), sizeof(uint8_t), bytearray->size(), stream);
+	// the buffer can be modified by other threads once the lock is released
+	const std::vector<uint8_t> bytearray(*buffer.data<LibObject<std::vector<uint8_t>>>()->impl);
+
+	auto amount = helper.blocking_call(
+		[&] {
+			return fwrite(bytearray.data(), sizeof(uint8_t), bytearray.size(), stream);
+		},
+		{file});
 
 	helper.return_value(
 		create_iterator(create_number(static_cast<double>(amount)),
-						(amount < bytearray->size()) ? create_number(errno) : WeakReference::create<None>()));
+						(amount < bytearray.size()) ? create_number(errno) : WeakReference::create<None>()));
 }
 
 MINT_FUNCTION(mint_file_fflush, 1, cursor) {
@@ -656,6 +698,10 @@ MINT_FUNCTION(mint_file_fflush, 1, cursor) {
 	FunctionHelper helper(cursor, 1);
 	Reference &file = helper.pop_parameter();
 	FILE *stream = file.data<LibObject<FILE>>()->impl;
-	int status = fflush(stream);
+	int status = helper.blocking_call(
+		[stream] {
+			return fflush(stream);
+		},
+		{file});
 	helper.return_value(status ? create_number(errno) : WeakReference::create<None>());
 }
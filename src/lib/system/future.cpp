@@ -27,7 +27,6 @@
 #include <mint/memory/casttool.h>
 #include <mint/ast/abstractsyntaxtree.h>
 #include <mint/scheduler/scheduler.h>
-#include <mint/scheduler/processor.h>
 
 using namespace mint;
 
@@ -99,16 +98,18 @@ MINT_FUNCTION(mint_future_wait_for, 2, cursor) {
 	Reference &d_ptr = helper.pop_parameter();
 
 	if (d_ptr.data<LibObject<std::future<WeakReference>>>()->impl->valid()) {
-		unlock_processor();
-		switch (d_ptr.data<LibObject<std::future<WeakReference>>>()->impl->wait_for(
-			std::chrono::milliseconds(to_integer(cursor, time)))) {
+		const auto timeout = std::chrono::milliseconds(to_integer(cursor, time));
+		std::future_status status = std::future_status::timeout;
+		{
+			auto region = helper.blocking_region({d_ptr});
+			status = d_ptr.data<LibObject<std::future<WeakReference>>>()->impl->wait_for(timeout);
+		}
+		switch (status) {
 		case std::future_status::deferred:
 		case std::future_status::timeout:
-			lock_processor();
 			helper.return_value(create_boolean(false));
 			break;
 		case std::future_status::ready:
-			lock_processor();
 			helper.return_value(create_boolean(true));
 		}
 	}
@@ -123,9 +124,8 @@ MINT_FUNCTION(mint_future_wait, 1, cursor) {
 	const Reference &d_ptr = helper.pop_parameter();
 
 	if (d_ptr.data<LibObject<std::future<WeakReference>>>()->impl->valid()) {
-		unlock_processor();
+		auto region = helper.blocking_region({d_ptr});
 		d_ptr.data<LibObject<std::future<WeakReference>>>()->impl->wait();
-		lock_processor();
 	}
 }
 
@@ -24,7 +24,6 @@
 #include <mint/memory/functiontool.h>
 #include <mint/memory/operatortool.h>
 #include <mint/memory/casttool.h>
-#include <mint/scheduler/processor.h>
 
 #include <mutex>
 
@@ -122,8 +121,7 @@ MINT_FUNCTION(mint_mutex_lock, 1, cursor) {
 	FunctionHelper helper(cursor, 1);
 
 	WeakReference self = std::move(helper.pop_parameter());
-
-	unlock_processor();
+	auto region = helper.blocking_region({self});
 
 	switch (self.data<LibObject<AbstractMutex>>()->impl->type()) {
 	case AbstractMutex::NORMAL:
@@ -133,8 +131,6 @@ MINT_FUNCTION(mint_mutex_lock, 1, cursor) {
 		self.data<LibObject<RecursiveMutex>>()->impl->handle.lock();
 		break;
 	}
-
-	lock_processor();
 }
 
 MINT_FUNCTION(mint_mutex_unlock, 1, cursor) {
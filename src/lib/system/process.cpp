@@ -492,7 +492,13 @@ MINT_FUNCTION(mint_process_waitpid, 4, cursor) {
 
 	bool finished = false;
 
-	if (WaitForSingleObject(handle, wait_for_finished ? INFINITE : 0) == WAIT_OBJECT_0) {
+	const DWORD status = helper.blocking_call(
+		[&] {
+			return WaitForSingleObject(handle, wait_for_finished ? INFINITE : 0);
+		},
+		{exit_code, exit_status});
+
+	if (status == WAIT_OBJECT_0) {
 
 		DWORD value = 0;
 
@@ -518,7 +524,12 @@ MINT_FUNCTION(mint_process_waitpid, 4, cursor) {
 	}
 
 	do {
-		if (waitpid(pid, &status, options) == pid) {
+		const int result = helper.blocking_call(
+			[&] {
+				return waitpid(pid, &status, options);
+			},
+			{exit_code, exit_status});
+		if (result == pid) {
 			exit_status.data<Boolean>()->value = WIFEXITED(status);
 			exit_code.data<Number>()->value = WEXITSTATUS(status);
 			finished = true;
@@ -66,8 +66,8 @@ WeakReference get_d_ptr(Reference &reference) {
 	return {};
 }
 
-int write_binary_data(FILE *stream, const std::vector<uint8_t> *data) {
-	return fwrite(data->data(), sizeof(uint8_t), data->size(), stream);
+int write_binary_data(FILE *stream, const std::vector<uint8_t> &data) {
+	return fwrite(data.data(), sizeof(uint8_t), data.size(), stream);
 }
 
 int write_string_data(FILE *stream, const std::string &data) {
@@ -264,6 +264,7 @@ MINT_FUNCTION(mint_terminal_edit_line, 1, cursor) {
 
 MINT_FUNCTION(mint_terminal_flush, 0, cursor) {
 	FunctionHelper helper(cursor, 0);
+	auto region = helper.blocking_region();
 	fflush(stdout);
 	fflush(stderr);
 }
@@ -281,20 +282,18 @@ MINT_FUNCTION(mint_terminal_readchar, 0, cursor) {
 	int fd = fileno(stdin);
 
 	char buffer[5];
+	size_t length = 0;
 
-	if (read(fd, buffer, 1) > 0) {
-
-		size_t length = utf8_code_point_length(static_cast<byte_t>(*buffer));
-
-		if (length > 1) {
-			if (read(fd, buffer + 1, length - 1) > 0) {
-				helper.return_value(create_string(std::string(buffer, length)));
-			}
-		}
-		else {
-			helper.return_value(create_string(std::string(buffer, 1)));
+	if (auto region = helper.blocking_region(); read(fd, buffer, 1) > 0) {
+		length = utf8_code_point_length(static_cast<byte_t>(*buffer));
+		if (length > 1 && read(fd, buffer + 1, length - 1) <= 0) {
+			length = 0;
 		}
 	}
+
+	if (length) {
+		helper.return_value(create_string(std::string(buffer, length)));
+	}
 }
 
 MINT_FUNCTION(mint_terminal_readline, 0, cursor) {
@@ -304,10 +303,15 @@ MINT_FUNCTION(mint_terminal_readline, 0, cursor) {
 	size_t size = 0;
 	char *buffer = nullptr;
 
-	if (getline(&buffer, &size, stdin) != -1) {
+	const auto read = helper.blocking_call([&] {
+		return getline(&buffer, &size, stdin);
+	});
+
+	if (read != -1) {
 		helper.return_value(create_string(buffer));
-		free(buffer);
 	}
+
+	free(buffer);
 }
 
 MINT_FUNCTION(mint_terminal_read, 1, cursor) {
@@ -318,10 +322,15 @@ MINT_FUNCTION(mint_terminal_read, 1, cursor) {
 	char *buffer = nullptr;
 	std::string delim = to_string(helper.pop_parameter());
 
-	if (getdelim(&buffer, &size, delim.front(), stdin) != -1) {
+	const auto read = helper.blocking_call([&] {
+		return getdelim(&buffer, &size, delim.front(), stdin);
+	});
+
+	if (read != -1) {
 		helper.return_value(create_string(buffer));
-		free(buffer);
 	}
+
+	free(buffer);
 }
 
 MINT_FUNCTION(mint_terminal_write, 1, cursor) {
@@ -331,10 +340,18 @@ MINT_FUNCTION(mint_terminal_write, 1, cursor) {
 	int amount = EOF;
 
 	if (is_instance_of(data, symbols::DataStream)) {
-		amount = write_binary_data(stdout, get_d_ptr(data).data<LibObject<std::vector<uint8_t>>>()->impl);
+		WeakReference d_ptr = get_d_ptr(data);
+		// the buffer can be modified by other threads once the lock is released
+		const std::vector<uint8_t> buffer(*d_ptr.data<LibObject<std::vector<uint8_t>>>()->impl);
+		amount = helper.blocking_call([&] {
+			return write_binary_data(stdout, buffer);
+		});
 	}
 	else {
-		amount = write_string_data(stdout, to_string(data));
+		const std::string str = to_string(data);
+		amount = helper.blocking_call([&] {
+			return write_string_data(stdout, str);
+		});
 	}
 
 	helper.return_value(create_iterator(create_number(static_cast<double>(amount)),
@@ -348,10 +365,18 @@ MINT_FUNCTION(mint_terminal_write_error, 1, cursor) {
 	int amount = EOF;
 
 	if (is_instance_of(data, symbols::DataStream)) {
-		amount = write_binary_data(stderr, get_d_ptr(data).data<LibObject<std::vector<uint8_t>>>()->impl);
+		WeakReference d_ptr = get_d_ptr(data);
+		// the buffer can be modified by other threads once the lock is released
+		const std::vector<uint8_t> buffer(*d_ptr.data<LibObject<std::vector<uint8_t>>>()->impl);
+		amount = helper.blocking_call([&] {
+			return write_binary_data(stderr, buffer);
+		});
 	}
 	else {
-		amount = write_string_data(stderr, to_string(data));
+		const std::string str = to_string(data);
+		amount = helper.blocking_call([&] {
+			return write_string_data(stderr, str);
+		});
 	}
 
 	helper.return_value(create_iterator(create_number(static_cast<double>(amount)),
@@ -400,8 +425,13 @@ MINT_FUNCTION(mint_terminal_wait, 1, cursor) {
 		dwMilliseconds = static_cast<DWORD>(to_integer(cursor, timeout));
 	}
 
-	DWORD ret = WaitForSingleObjectEx(h, dwMilliseconds, true);
-	helper.return_value(create_boolean(ret == WAIT_OBJECT_0));
+	bool result = false;
+
+	if (auto region = helper.blocking_region(); WaitForSingleObjectEx(h, dwMilliseconds, true) == WAIT_OBJECT_0) {
+		result = true;
+	}
+
+	helper.return_value(create_boolean(result));
 #else
 	pollfd fds;
 	fds.events = POLLIN;
@@ -414,9 +444,8 @@ MINT_FUNCTION(mint_terminal_wait, 1, cursor) {
 	}
 
 	bool result = false;
-	int ret = poll(&fds, 1, time_ms);
 
-	if ((ret > 0) && (fds.revents & POLLIN)) {
+	if (auto region = helper.blocking_region(); (poll(&fds, 1, time_ms) > 0) && (fds.revents & POLLIN)) {
 		result = true;
 	}
 
@@ -25,6 +25,7 @@
 #include <mint/memory/operatortool.h>
 #include <mint/memory/memorytool.h>
 #include <mint/memory/casttool.h>
+#include <mint/memory/builtin/hash.h>
 #include <mint/ast/abstractsyntaxtree.h>
 #include <mint/scheduler/scheduler.h>
 #include <mint/scheduler/processor.h>
@@ -158,10 +159,10 @@ MINT_FUNCTION(mint_thread_join, 1, cursor) {
 	Reference &thread_id = helper.pop_parameter();
 
 	if (Scheduler *scheduler = Scheduler::instance()) {
+		const auto id = static_cast<Process::ThreadId>(to_integer(cursor, thread_id));
 		try {
-			unlock_processor();
-			scheduler->join_thread(static_cast<Process::ThreadId>(to_integer(cursor, thread_id)));
-			lock_processor();
+			auto region = helper.blocking_region();
+			scheduler->join_thread(id);
 		}
 		catch (const std::system_error &error) {
 			helper.return_value(create_number(errno_from_error_code(error.code())));
@@ -171,15 +172,28 @@ MINT_FUNCTION(mint_thread_join, 1, cursor) {
 
 MINT_FUNCTION(mint_thread_wait, 0, cursor) {
 	FunctionHelper helper(cursor, 0);
-	unlock_processor();
+	auto region = helper.blocking_region();
 	std::this_thread::yield();
-	lock_processor();
+}
+
+MINT_FUNCTION(mint_thread_lock_statistics, 0, cursor) {
+
+	FunctionHelper helper(cursor, 0);
+	const ProcessorLockStatistics statistics = processor_lock_statistics();
+	WeakReference result = create_hash();
+
+	hash_insert(result.data<Hash>(), create_string("acquisitions"), create_number(static_cast<double>(statistics.acquisitions)));
+	hash_insert(result.data<Hash>(), create_string("contentions"), create_number(static_cast<double>(statistics.contentions)));
+	hash_insert(result.data<Hash>(), create_string("handoffs"), create_number(static_cast<double>(statistics.handoffs)));
+	hash_insert(result.data<Hash>(), create_string("waitTime"),
+				create_number(std::chrono::duration<double, std::milli>(statistics.wait_time).count()));
+
+	helper.return_value(std::move(result));
 }
 
 MINT_FUNCTION(mint_thread_sleep, 1, cursor) {
 	FunctionHelper helper(cursor, 1);
-	Reference &time = helper.pop_parameter();
-	unlock_processor();
-	std::this_thread::sleep_for(std::chrono::milliseconds(to_integer(cursor, time)));
-	lock_processor();
+	const auto time = std::chrono::milliseconds(to_integer(cursor, helper.pop_parameter()));
+	auto region = helper.blocking_region();
+	std::this_thread::sleep_for(time);
 }
@@ -116,8 +116,7 @@ Cursor::Cursor(AbstractSyntaxTree *ast, Module *module, Cursor *parent) :
 	m_parent(parent),
 	m_child(nullptr),
 	m_stack(parent ? parent->m_stack : GarbageCollector::instance().create_stack()),
-	m_current_context(g_pool.allocate()) {
-	new (m_current_context) Context(module);
+	m_current_context(create_context(module)) {
 	m_current_context->symbols = new SymbolTable;
 
 	if (m_parent) {
@@ -140,8 +139,7 @@ Cursor::~Cursor() {
 		exit_call();
 	}
 
-	m_current_context->~Context();
-	g_pool.deallocate(m_current_context);
+	destroy_context(m_current_context);
 
 	m_ast->remove_cursor(this);
 }
@@ -158,17 +156,34 @@ void Cursor::jmp(size_t pos) {
 	m_current_context->iptr = pos;
 }
 
+void Cursor::replace_command(Node::Command command) {
+	// the command node of the current instruction is the last one returned by next()
+	m_current_context->module->replace_node(m_current_context->iptr - 1, command);
+}
+
 void Cursor::call(Module::Handle *handle, int signature, Class *metadata) {
 
 	m_call_stack.emplace_back(m_current_context);
 
-	new (m_current_context = g_pool.allocate()) Context(m_ast->get_module(handle->module));
+	Module *module = m_ast->get_module(handle->module);
+
+	// the call of a generator can be resumed after the next calls have
+	// returned, only the other calls are stacked
+	if (handle->generator) {
+		m_current_context = create_context(module);
+		if (handle->symbols) {
+			m_current_context->symbols = new SymbolTable(metadata);
+			m_current_context->symbols->reserve_fast(handle->fast_count);
+		}
+	}
+	else {
+		m_current_context = create_stacked_context(module, handle, metadata);
+	}
+
 	m_current_context->iptr = handle->offset;
 
 	if (handle->symbols) {
-		m_current_context->symbols = new SymbolTable(metadata);
 		m_current_context->symbols->open_package(handle->package);
-		m_current_context->symbols->reserve_fast(handle->fast_count);
 	}
 
 	if (handle->generator) {
@@ -185,15 +200,14 @@ void Cursor::call(Module *module, size_t pos, PackageData *package, Class *metad
 
 	m_call_stack.emplace_back(m_current_context);
 
-	new (m_current_context = g_pool.allocate()) Context(module);
+	m_current_context = create_context(module);
 	m_current_context->symbols = new SymbolTable(metadata);
 	m_current_context->symbols->open_package(package);
 	m_current_context->iptr = pos;
 }
 
 void Cursor::exit_call() {
-	m_current_context->~Context();
-	g_pool.deallocate(m_current_context);
+	destroy_context(m_current_context);
 	m_current_context = m_call_stack.back();
 	m_call_stack.pop_back();
 }
@@ -217,6 +231,8 @@ bool Cursor::is_in_generator() const {
 
 std::unique_ptr<SavedState> Cursor::interrupt() {
 
+	// only the calls of generators are interrupted, their context is not stacked
+	assert(!m_current_context->stacked);
 	std::unique_ptr<SavedState> state(new SavedState(this, m_current_context));
 	m_current_context = m_call_stack.back();
 	m_call_stack.pop_back();
@@ -245,8 +261,15 @@ void Cursor::restore(std::unique_ptr<SavedState> state) {
 void Cursor::destroy(SavedState *state) {
 	assert(state->cursor == this);
 	if (state->context) {
-		state->context->~Context();
-		g_pool.deallocate(state->context);
+		destroy_context(state->context);
+	}
+}
+
+void Cursor::mark() {
+	// the functions of the pending calls are only held by the cursor, they
+	// are marked at once instead of being registered as roots one by one
+	for (const Call &call : m_waiting_calls.calls()) {
+		call.m_function.data()->mark();
 	}
 }
 
@@ -416,5 +439,48 @@ Cursor::Context::~Context() {
 		::close_printer(printer);
 	}
 	delete generator;
-	delete symbols;
+	if (!stacked) {
+		delete symbols;
+	}
+	else if (symbols) {
+		symbols->~SymbolTable();
+	}
+}
+
+Cursor::Context *Cursor::create_context(Module *module) {
+	return new (g_pool.allocate()) Context(module);
+}
+
+Cursor::Context *Cursor::create_stacked_context(Module *module, Module::Handle *handle, Class *metadata) {
+
+	// the context, its symbol table and the fast symbols are allocated at once
+	// and released when the call returns
+	size_t size = CONTEXT_SIZE;
+	if (handle->symbols) {
+		size += SYMBOL_TABLE_SIZE + handle->fast_count * sizeof(SymbolTable::fast_type);
+	}
+
+	auto *frame = static_cast<byte_t *>(m_frames.allocate(size));
+	auto *context = new (frame) Context(module);
+	context->stacked = true;
+	if (handle->symbols) {
+		context->symbols = new (frame + CONTEXT_SIZE) SymbolTable(metadata);
+		if (handle->fast_count) {
+			auto *fasts = reinterpret_cast<SymbolTable::fast_type *>(frame + CONTEXT_SIZE + SYMBOL_TABLE_SIZE);
+			context->symbols->reserve_fast(fasts, handle->fast_count);
+		}
+	}
+
+	return context;
+}
+
+void Cursor::destroy_context(Context *context) {
+	if (context->stacked) {
+		context->~Context();
+		m_frames.deallocate(context);
+	}
+	else {
+		context->~Context();
+		g_pool.deallocate(context);
+	}
 }
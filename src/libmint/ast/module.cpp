@@ -22,6 +22,7 @@
  */
 
 #include "mint/ast/module.h"
+#include "mint/memory/membercache.h"
 
 #include <memory>
 #include <algorithm>
@@ -33,7 +34,8 @@ Module::~Module() {
 	std::for_each(m_symbols.begin(), m_symbols.end(), [](const auto &ptr) {
 		delete ptr.second;
 	});
-	std::for_each(m_constants.begin(), m_constants.end(), std::default_delete<Reference>());
+	std::for_each(m_constants.begin(), m_constants.end(), std::default_delete<StrongReference>());
+	std::for_each(m_member_caches.begin(), m_member_caches.end(), std::default_delete<MemberCache>());
 	std::for_each(m_handles.begin(), m_handles.end(), std::default_delete<Handle>());
 }
 
@@ -60,17 +62,24 @@ Module::Handle *Module::make_builtin_handle(PackageData *package, Id module, siz
 }
 
 Reference *Module::make_constant(Data *data) {
-	Reference *constant = new StrongReference(Reference::CONST_ADDRESS | Reference::CONST_VALUE, data);
+	auto *constant = new StrongReference(Reference::CONST_ADDRESS | Reference::CONST_VALUE, data);
 	m_constants.push_back(constant);
 	return constant;
 }
 
+MemberCache *Module::make_member_cache() {
+	auto *cache = new MemberCache;
+	m_member_caches.push_back(cache);
+	return cache;
+}
+
 Symbol *Module::make_symbol(const char *name) {
 
-	auto it = m_symbols.find(name);
+	const Symbol symbol(name);
+	auto it = m_symbols.find(symbol);
 
 	if (it == m_symbols.end()) {
-		it = m_symbols.emplace(name, new Symbol(name)).first;
+		it = m_symbols.emplace(symbol, new Symbol(symbol)).first;
 	}
 
 	return it->second;
@@ -91,3 +100,7 @@ void Module::push_nodes(const std::initializer_list<Node> &nodes) {
 void Module::replace_node(size_t offset, const Node &node) {
 	m_tree[offset] = node;
 }
+
+void Module::pop_nodes(size_t count) {
+	m_tree.erase(std::prev(m_tree.end(), static_cast<std::ptrdiff_t>(count)), m_tree.end());
+}
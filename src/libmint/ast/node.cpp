@@ -36,3 +36,6 @@ Node::Node(Symbol *symbol) :
 
 Node::Node(Reference *constant) :
 	constant(constant) {}
+
+Node::Node(MemberCache *cache) :
+	cache(cache) {}
@@ -22,40 +22,80 @@
  */
 
 #include "mint/ast/symbol.h"
-#include "mint/config.h"
+#include "mint/system/assert.h"
+
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
+#include <new>
 
 using namespace mint;
 
-Symbol::Symbol(Symbol &&other) noexcept :
-	m_size(other.m_size),
-	m_hash(other.m_hash),
-	m_symbol(other.m_symbol) {
-	other.m_symbol = nullptr;
+namespace {
+
+// the table is never destroyed, so the symbols of static objects stay valid
+// until the end of the process
+std::shared_mutex &symbols_mutex() {
+	static auto *g_mutex = new std::shared_mutex;
+	return *g_mutex;
+}
+
+template<class Entry>
+std::unordered_map<std::string_view, Entry *> &symbols_table() {
+	static auto *g_entries = new std::unordered_map<std::string_view, Entry *>;
+	return *g_entries;
 }
 
-Symbol::Symbol(const Symbol &other) :
-	m_size(other.m_size),
-	m_hash(other.m_hash),
-	m_symbol(strdup(other.m_symbol)) {}
+}
+
+const Symbol::Entry *Symbol::intern(std::string_view symbol) {
+
+	auto &entries = symbols_table<const Entry>();
 
-Symbol::~Symbol() {
-	free(m_symbol);
+	{
+		std::shared_lock<std::shared_mutex> lock(symbols_mutex());
+		if (auto it = entries.find(symbol); it != entries.end()) {
+			it->second->refcount.fetch_add(1, std::memory_order_relaxed);
+			return it->second;
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(symbols_mutex());
+	if (auto it = entries.find(symbol); it != entries.end()) {
+		it->second->refcount.fetch_add(1, std::memory_order_relaxed);
+		return it->second;
+	}
+
+	// the name is stored right after its entry
+	void *memory = assert_not_null<std::bad_alloc>(malloc(sizeof(Entry) + symbol.length() + 1));
+	auto *name = static_cast<char *>(memory) + sizeof(Entry);
+	memcpy(name, symbol.data(), symbol.length());
+	name[symbol.length()] = '\0';
+	auto *entry = new (memory) Entry {make_symbol_hash(symbol), symbol.length(), name, {1}};
+	entries.emplace(std::string_view(name, symbol.length()), entry);
+	return entry;
 }
 
-Symbol &Symbol::operator=(const Symbol &other) {
-	if (UNLIKELY(this == &other)) {
-		return *this;
+void Symbol::release(const Entry *entry) {
+
+	// the entry can only be removed while no lookup can find it again
+	size_t refcount = entry->refcount.load(std::memory_order_relaxed);
+	while (refcount > 1) {
+		if (entry->refcount.compare_exchange_weak(refcount, refcount - 1, std::memory_order_release,
+												  std::memory_order_relaxed)) {
+			return;
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(symbols_mutex());
+	if (entry->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		symbols_table<const Entry>().erase(std::string_view(entry->name, entry->size));
+		entry->~Entry();
+		free(const_cast<Entry *>(entry));
 	}
-	m_size = other.m_size;
-	m_hash = other.m_hash;
-	m_symbol = static_cast<char *>(realloc(m_symbol, other.m_size + 1));
-	memcpy(m_symbol, other.m_symbol, other.m_size + 1);
-	return *this;
 }
 
-Symbol &Symbol::operator=(Symbol &&other) noexcept {
-	m_size = other.m_size;
-	m_hash = other.m_hash;
-	std::swap(m_symbol, other.m_symbol);
-	return *this;
+size_t Symbol::interned_count() {
+	std::shared_lock<std::shared_mutex> lock(symbols_mutex());
+	return symbols_table<const Entry>().size();
 }
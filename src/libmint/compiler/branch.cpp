@@ -22,6 +22,7 @@
  */
 
 #include "branch.h"
+#include "optimizer.h"
 #include "mint/compiler/buildtool.h"
 #include "mint/ast/module.h"
 
@@ -48,12 +49,60 @@ void Branch::set_pending_new_line(size_t line_number) {
 
 void Branch::commit_line() {
 	if (m_pending_new_line) {
+		m_last_target = next_node_offset();
 		std::invoke(m_pending_new_line.value());
 		m_pending_new_line = std::nullopt;
 	}
 }
 
+void Branch::push_instruction(Node::Command command) {
+	if (m_instructions.size() == 2) {
+		m_instructions.erase(m_instructions.begin());
+	}
+	m_instructions.push_back(next_node_offset());
+	push_node(command);
+}
+
+Reference *Branch::trailing_constant(size_t depth) {
+
+	// the last instructions must be contiguous constant loads emitted after the
+	// last jump target, otherwise some nodes can not be removed
+	size_t offset = next_node_offset();
+	for (auto it = m_instructions.rbegin(); it != m_instructions.rend(); ++it) {
+		if (offset < 2 || *it != offset - 2 || *it < m_last_target) {
+			return nullptr;
+		}
+		if (node_at(offset -= 2).command != Node::LOAD_CONSTANT) {
+			return nullptr;
+		}
+		if (depth-- == 0) {
+			return node_at(offset + 1).constant;
+		}
+	}
+
+	return nullptr;
+}
+
+void Branch::pop_instruction() {
+	assert(!m_instructions.empty());
+	pop_nodes(next_node_offset() - m_instructions.back());
+	m_instructions.pop_back();
+}
+
+size_t Branch::next_target_offset() {
+	return m_last_target = next_node_offset();
+}
+
+void Branch::drop_next_jump_forward() {
+	m_drop_jump_forward = true;
+}
+
 void Branch::start_jump_forward() {
+	if (m_drop_jump_forward) {
+		m_jump_forward.emplace_back();
+		m_drop_jump_forward = false;
+		return;
+	}
 	m_jump_forward.emplace_back(ForwardNodeIndex({next_node_offset()}));
 	m_labels.insert(next_node_offset());
 	push_node(0);
@@ -66,15 +115,17 @@ void Branch::shift_jump_forward() {
 
 void Branch::resolve_jump_forward() {
 
+	const size_t target = next_target_offset();
+
 	for (size_t offset : m_jump_forward.back()) {
-		replace_node(offset, static_cast<int>(next_node_offset()));
+		replace_node(offset, static_cast<int>(target));
 	}
 
 	m_jump_forward.pop_back();
 }
 
 void Branch::start_jump_backward() {
-	m_jump_backward.emplace_back(next_node_offset());
+	m_jump_backward.emplace_back(next_target_offset());
 }
 
 void Branch::resolve_jump_backward() {
@@ -106,9 +157,7 @@ void Branch::insert_label(size_t offset) {
 }
 
 MainBranch::MainBranch(BuildContext *context) :
-#ifdef BUILD_TYPE_DEBUG
 	m_offset(context->data.module->next_node_offset()),
-#endif
 	m_context(context) {
 }
 
@@ -124,6 +173,10 @@ void MainBranch::replace_node(size_t offset, const Node &node) {
 	m_context->data.module->at(offset) = node;
 }
 
+void MainBranch::pop_nodes(size_t count) {
+	m_context->data.module->pop_nodes(count);
+}
+
 size_t MainBranch::next_node_offset() const {
 	return m_context->data.module->next_node_offset();
 }
@@ -142,6 +195,8 @@ void MainBranch::on_new_line(size_t line_number) {
 
 void MainBranch::build() {
 
+	optimize_nodes(m_context->data.module, m_offset, m_context->data.module->next_node_offset());
+
 #if defined(BUILD_TYPE_DEBUG) && defined(MINT_DUMP_ASSEMBLY)
 	if (m_context->data.id != Module::INVALID_ID) {
 		AbstractSyntaxTree *ast = AbstractSyntaxTree::instance();
@@ -183,6 +238,10 @@ void SubBranch::replace_node(size_t offset, const Node &node) {
 	m_tree[offset] = node;
 }
 
+void SubBranch::pop_nodes(size_t count) {
+	m_tree.erase(std::prev(m_tree.end(), static_cast<std::ptrdiff_t>(count)), m_tree.end());
+}
+
 size_t SubBranch::next_node_offset() const {
 	return m_tree.size();
 }
@@ -53,6 +53,7 @@ public:
 	virtual void push_node(const Node &node) = 0;
 	virtual void push_nodes(const std::vector<Node> &nodes) = 0;
 	virtual void replace_node(size_t offset, const Node &node) = 0;
+	virtual void pop_nodes(size_t count) = 0;
 	[[nodiscard]] virtual size_t next_node_offset() const = 0;
 	[[nodiscard]] virtual Node &node_at(size_t offset) = 0;
 
@@ -64,6 +65,13 @@ public:
 	void set_pending_new_line(size_t line_number);
 	void commit_line();
 
+	void push_instruction(Node::Command command);
+	[[nodiscard]] Reference *trailing_constant(size_t depth);
+	void pop_instruction();
+
+	[[nodiscard]] size_t next_target_offset();
+	void drop_next_jump_forward();
+
 	void start_jump_forward();
 	void shift_jump_forward();
 	void resolve_jump_forward();
@@ -84,6 +92,10 @@ private:
 	std::deque<ForwardNodeIndex> m_jump_forward;
 	std::deque<BackwardNodeIndex> m_jump_backward;
 	std::unordered_set<size_t> m_labels;
+
+	std::vector<size_t> m_instructions;
+	size_t m_last_target = 0;
+	bool m_drop_jump_forward = false;
 };
 
 Branch::ForwardNodeIndex *Branch::next_jump_forward() {
@@ -106,6 +118,7 @@ public:
 	void push_node(const Node &node) override;
 	void push_nodes(const std::vector<Node> &nodes) override;
 	void replace_node(size_t offset, const Node &node) override;
+	void pop_nodes(size_t count) override;
 	[[nodiscard]] size_t next_node_offset() const override;
 	[[nodiscard]] Node &node_at(size_t offset) override;
 
@@ -115,9 +128,7 @@ public:
 	void build() override;
 
 private:
-#ifdef BUILD_TYPE_DEBUG
 	size_t m_offset;
-#endif
 	BuildContext *m_context;
 };
 
@@ -128,6 +139,7 @@ public:
 	void push_node(const Node &node) override;
 	void push_nodes(const std::vector<Node> &nodes) override;
 	void replace_node(size_t offset, const Node &node) override;
+	void pop_nodes(size_t count) override;
 	[[nodiscard]] size_t next_node_offset() const override;
 	[[nodiscard]] Node &node_at(size_t offset) override;
 
@@ -33,6 +33,7 @@
 #include "context.h"
 #include "branch.h"
 #include "block.h"
+#include "optimizer.h"
 
 #include <iterator>
 
@@ -415,7 +416,7 @@ void BuildContext::set_default_label() {
 		if (case_table->default_label) {
 			parse_error("multiple default labels in one switch");
 		}
-		case_table->default_label = new size_t(m_branch->next_node_offset());
+		case_table->default_label = new size_t(m_branch->next_target_offset());
 	}
 }
 
@@ -423,7 +424,7 @@ void BuildContext::build_case_table() {
 
 	if (CaseTable *case_table = current_breakable_block()->case_table) {
 
-		m_branch->replace_node(case_table->origin, static_cast<int>(m_branch->next_node_offset()));
+		m_branch->replace_node(case_table->origin, static_cast<int>(m_branch->next_target_offset()));
 
 		for (const auto &label : case_table->labels) {
 			push_node(Node::RELOAD_REFERENCE);
@@ -486,7 +487,7 @@ void BuildContext::resolve_jump_backward() {
 void BuildContext::start_definition() {
 	auto *def = new Definition;
 	def->function = data.module->make_constant(GarbageCollector::instance().alloc<Function>());
-	def->begin_offset = m_branch->next_node_offset();
+	def->begin_offset = m_branch->next_target_offset();
 	m_definitions.push(def);
 }
 
@@ -539,7 +540,7 @@ void BuildContext::set_generator() {
 }
 
 void BuildContext::set_exit_point() {
-	current_definition()->exit_points.emplace_back(m_branch->next_node_offset());
+	current_definition()->exit_points.emplace_back(m_branch->next_target_offset());
 }
 
 bool BuildContext::save_parameters() {
@@ -577,7 +578,7 @@ bool BuildContext::add_definition_signature() {
 	int signature = static_cast<int>(def->parameters.size());
 	Module::Handle *handle = data.module->make_handle(current_package(), data.id, def->begin_offset);
 	def->function->data<Function>()->mapping.emplace(signature, Function::Signature(handle, def->capture != nullptr));
-	def->begin_offset = m_branch->next_node_offset();
+	def->begin_offset = m_branch->next_target_offset();
 	return true;
 }
 
@@ -867,7 +868,9 @@ void BuildContext::start_condition() {
 void BuildContext::resolve_condition() {}
 
 void BuildContext::push_node(Node::Command command) {
-	m_branch->push_node(command);
+	if (!fold_constants(command)) {
+		m_branch->push_instruction(command);
+	}
 }
 
 void BuildContext::push_node(int parameter) {
@@ -890,6 +893,69 @@ void BuildContext::push_node(Reference *constant) {
 	m_branch->push_node(constant);
 }
 
+bool BuildContext::fold_constants(Node::Command command) {
+
+	switch (command) {
+	case Node::JUMP_ZERO:
+		if (const Reference *value = m_branch->trailing_constant(0)) {
+			if (const std::optional<bool> condition = fold_condition(*value)) {
+				m_branch->pop_instruction();
+				if (*condition) {
+					m_branch->drop_next_jump_forward();
+				}
+				else {
+					m_branch->push_instruction(Node::JUMP);
+				}
+				return true;
+			}
+		}
+		return false;
+
+	case Node::NOT_OP:
+	case Node::POS_OP:
+	case Node::NEG_OP:
+		if (const Reference *value = m_branch->trailing_constant(0)) {
+			if (Data *result = fold_operation(command, *value)) {
+				m_branch->pop_instruction();
+				push_node(Node::LOAD_CONSTANT);
+				push_node(result);
+				return true;
+			}
+		}
+		return false;
+
+	case Node::ADD_OP:
+	case Node::SUB_OP:
+	case Node::MUL_OP:
+	case Node::DIV_OP:
+	case Node::POW_OP:
+	case Node::EQ_OP:
+	case Node::NE_OP:
+	case Node::LT_OP:
+	case Node::GT_OP:
+	case Node::LE_OP:
+	case Node::GE_OP:
+		if (const Reference *lvalue = m_branch->trailing_constant(1)) {
+			const Reference *rvalue = m_branch->trailing_constant(0);
+			if (Data *result = fold_operation(command, *lvalue, *rvalue)) {
+				m_branch->pop_instruction();
+				m_branch->pop_instruction();
+				push_node(Node::LOAD_CONSTANT);
+				push_node(result);
+				return true;
+			}
+		}
+		return false;
+
+	default:
+		return false;
+	}
+}
+
+void BuildContext::push_member_cache() {
+	m_branch->push_node(data.module->make_member_cache());
+}
+
 void BuildContext::push_branch(Branch *branch) {
 	m_branches.push(m_branch);
 	m_branch = branch;
@@ -28,4 +28,4 @@ using namespace mint;
 
 CaseTable::Label::Label(Branch *parent) :
 	condition(new SubBranch(parent)),
-	offset(parent->next_node_offset()) {}
+	offset(parent->next_target_offset()) {}
@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2025 Gauvain CHERY.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "optimizer.h"
+#include "mint/ast/module.h"
+#include "mint/memory/garbagecollector.h"
+#include "mint/memory/builtin/string.h"
+#include "mint/memory/class.h"
+
+#include <cassert>
+#include <cmath>
+
+using namespace mint;
+
+namespace {
+
+struct Superinstruction {
+	Node::Command first;
+	Node::Command second;
+	Node::Command fused;
+};
+
+/*
+ * Sequences are selected from the opcode pair frequencies observed on the
+ * test suite and on numeric loops. A superinstruction only replaces the
+ * command node of the first instruction, operands and the command node of
+ * the second instruction are kept in place. Jump targets pointing on the
+ * second instruction are then still valid. The first instruction must not
+ * be able to switch the cursor's context before the second one is decoded.
+ */
+constexpr const Superinstruction SUPERINSTRUCTIONS[] = {
+	{Node::LOAD_FAST, Node::LOAD_FAST, Node::LOAD_FAST_LOAD_FAST},
+	{Node::LOAD_FAST, Node::LOAD_CONSTANT, Node::LOAD_FAST_LOAD_CONSTANT},
+	{Node::LOAD_FAST, Node::LOAD_MEMBER, Node::LOAD_FAST_LOAD_MEMBER},
+	{Node::ADD_OP, Node::MOVE_OP, Node::ADD_OP_MOVE_OP},
+	{Node::SUB_OP, Node::MOVE_OP, Node::SUB_OP_MOVE_OP},
+	{Node::MUL_OP, Node::MOVE_OP, Node::MUL_OP_MOVE_OP},
+	{Node::MOVE_OP, Node::UNLOAD_REFERENCE, Node::MOVE_OP_UNLOAD_REFERENCE},
+	{Node::EQ_OP, Node::JUMP_ZERO, Node::EQ_OP_JUMP_ZERO},
+	{Node::NE_OP, Node::JUMP_ZERO, Node::NE_OP_JUMP_ZERO},
+	{Node::LT_OP, Node::JUMP_ZERO, Node::LT_OP_JUMP_ZERO},
+	{Node::GT_OP, Node::JUMP_ZERO, Node::GT_OP_JUMP_ZERO},
+	{Node::LE_OP, Node::JUMP_ZERO, Node::LE_OP_JUMP_ZERO},
+	{Node::GE_OP, Node::JUMP_ZERO, Node::GE_OP_JUMP_ZERO},
+	{Node::INIT_MEMBER_CALL, Node::CALL_MEMBER, Node::INIT_MEMBER_CALL_MEMBER},
+};
+
+/*
+ * The switch has no default case so that a new command is reported by
+ * -Wswitch until its operands are counted here. A fused command keeps the
+ * operands of its first instruction, the command node of the second one
+ * follows them.
+ */
+size_t operand_count(Node::Command command) {
+	switch (command) {
+	case Node::LOAD_VAR_SYMBOL:
+	case Node::LOAD_VAR_MEMBER:
+	case Node::CLONE_REFERENCE:
+	case Node::RELOAD_REFERENCE:
+	case Node::UNLOAD_REFERENCE:
+	case Node::LOAD_EXTRA_ARGUMENTS:
+	case Node::FUNCTION_OVERLOAD:
+	case Node::ALLOC_ITERATOR:
+	case Node::ALLOC_ARRAY:
+	case Node::ALLOC_HASH:
+	case Node::CREATE_LIB:
+	case Node::REGEX_MATCH:
+	case Node::REGEX_UNMATCH:
+	case Node::STRICT_EQ_OP:
+	case Node::STRICT_NE_OP:
+	case Node::CLOSE_PACKAGE:
+	case Node::MOVE_OP:
+	case Node::COPY_OP:
+	case Node::ADD_OP:
+	case Node::SUB_OP:
+	case Node::MOD_OP:
+	case Node::MUL_OP:
+	case Node::DIV_OP:
+	case Node::POW_OP:
+	case Node::IS_OP:
+	case Node::EQ_OP:
+	case Node::NE_OP:
+	case Node::LT_OP:
+	case Node::GT_OP:
+	case Node::LE_OP:
+	case Node::GE_OP:
+	case Node::INC_OP:
+	case Node::DEC_OP:
+	case Node::NOT_OP:
+	case Node::AND_OP:
+	case Node::OR_OP:
+	case Node::BAND_OP:
+	case Node::BOR_OP:
+	case Node::XOR_OP:
+	case Node::COMPL_OP:
+	case Node::POS_OP:
+	case Node::NEG_OP:
+	case Node::SHIFT_LEFT_OP:
+	case Node::SHIFT_RIGHT_OP:
+	case Node::INCLUSIVE_RANGE_OP:
+	case Node::EXCLUSIVE_RANGE_OP:
+	case Node::SUBSCRIPT_OP:
+	case Node::SUBSCRIPT_MOVE_OP:
+	case Node::TYPEOF_OP:
+	case Node::MEMBERSOF_OP:
+	case Node::FIND_OP:
+	case Node::IN_OP:
+	case Node::FIND_DEFINED_VAR_SYMBOL:
+	case Node::FIND_DEFINED_VAR_MEMBER:
+	case Node::CHECK_DEFINED:
+	case Node::FIND_INIT:
+	case Node::FIND_NEXT:
+	case Node::RANGE_INIT:
+	case Node::RANGE_NEXT:
+	case Node::BEGIN_GENERATOR_EXPRESSION:
+	case Node::END_GENERATOR_EXPRESSION:
+	case Node::YIELD_EXPRESSION:
+	case Node::OPEN_PRINTER:
+	case Node::CLOSE_PRINTER:
+	case Node::PRINT:
+	case Node::UNSET_RETRIEVE_POINT:
+	case Node::RAISE:
+	case Node::YIELD:
+	case Node::EXIT_GENERATOR:
+	case Node::YIELD_EXIT_GENERATOR:
+	case Node::INIT_CAPTURE:
+	case Node::CAPTURE_ALL:
+	case Node::INIT_CALL:
+	case Node::INIT_VAR_MEMBER_CALL:
+	case Node::EXIT_CALL:
+	case Node::EXIT_THREAD:
+	case Node::EXIT_EXEC:
+	case Node::EXIT_MODULE:
+	case Node::ADD_OP_MOVE_OP:
+	case Node::SUB_OP_MOVE_OP:
+	case Node::MUL_OP_MOVE_OP:
+	case Node::MOVE_OP_UNLOAD_REFERENCE:
+	case Node::EQ_OP_JUMP_ZERO:
+	case Node::NE_OP_JUMP_ZERO:
+	case Node::LT_OP_JUMP_ZERO:
+	case Node::GT_OP_JUMP_ZERO:
+	case Node::LE_OP_JUMP_ZERO:
+	case Node::GE_OP_JUMP_ZERO:
+	case Node::ADD_NUMBER_NUMBER:
+	case Node::SUB_NUMBER_NUMBER:
+	case Node::MUL_NUMBER_NUMBER:
+	case Node::DIV_NUMBER_NUMBER:
+	case Node::EQ_NUMBER_NUMBER:
+	case Node::NE_NUMBER_NUMBER:
+	case Node::LT_NUMBER_NUMBER:
+	case Node::GT_NUMBER_NUMBER:
+	case Node::LE_NUMBER_NUMBER:
+	case Node::GE_NUMBER_NUMBER:
+	case Node::ADD_STRING_STRING:
+	case Node::EQ_STRING_STRING:
+	case Node::NE_STRING_STRING:
+		return 0;
+	case Node::LOAD_MODULE:
+	case Node::LOAD_SYMBOL:
+	case Node::LOAD_OPERATOR:
+	case Node::LOAD_CONSTANT:
+	case Node::RESET_SYMBOL:
+	case Node::INIT_ITERATOR:
+	case Node::INIT_ARRAY:
+	case Node::INIT_HASH:
+	case Node::OPEN_PACKAGE:
+	case Node::REGISTER_CLASS:
+	case Node::FIND_DEFINED_SYMBOL:
+	case Node::FIND_DEFINED_MEMBER:
+	case Node::FIND_CHECK:
+	case Node::RANGE_CHECK:
+	case Node::RANGE_ITERATOR_CHECK:
+	case Node::OR_PRE_CHECK:
+	case Node::AND_PRE_CHECK:
+	case Node::CASE_JUMP:
+	case Node::JUMP_ZERO:
+	case Node::JUMP:
+	case Node::SET_RETRIEVE_POINT:
+	case Node::CAPTURE_SYMBOL:
+	case Node::CAPTURE_AS:
+	case Node::CALL:
+	case Node::CALL_MEMBER:
+	case Node::CALL_BUILTIN:
+	case Node::INIT_OPERATOR_CALL:
+	case Node::INIT_EXCEPTION:
+	case Node::RESET_EXCEPTION:
+		return 1;
+	case Node::LOAD_FAST:
+	case Node::LOAD_MEMBER:
+	case Node::RESET_FAST:
+	case Node::DECLARE_SYMBOL:
+	case Node::DECLARE_FUNCTION:
+	case Node::INIT_MEMBER_CALL:
+	case Node::LOAD_FAST_LOAD_FAST:
+	case Node::LOAD_FAST_LOAD_CONSTANT:
+	case Node::LOAD_FAST_LOAD_MEMBER:
+	case Node::INIT_MEMBER_CALL_MEMBER:
+		return 2;
+	case Node::DECLARE_FAST:
+	case Node::INIT_PARAM:
+		return 3;
+	}
+
+	assert(false);
+	return 0;
+}
+
+bool find_superinstruction(Node::Command first, Node::Command second, Node::Command *fused) {
+	for (const Superinstruction &superinstruction : SUPERINSTRUCTIONS) {
+		if (superinstruction.first == first && superinstruction.second == second) {
+			*fused = superinstruction.fused;
+			return true;
+		}
+	}
+	return false;
+}
+
+void fuse_superinstructions(Module *module, size_t begin, size_t end) {
+
+	size_t offset = begin;
+
+	while (offset < end) {
+
+		const Node::Command command = module->at(offset).command;
+		const size_t next_offset = offset + 1 + operand_count(command);
+
+		if (next_offset < end) {
+			const Node::Command next_command = module->at(next_offset).command;
+			if (next_offset + 1 + operand_count(next_command) <= end) {
+				Node::Command fused;
+				if (find_superinstruction(command, next_command, &fused)) {
+					module->at(offset).command = fused;
+				}
+			}
+		}
+
+		offset = next_offset;
+	}
+}
+
+bool is_string(const Reference &value) {
+	return value.data()->format == Data::FMT_OBJECT
+		   && value.data<Object>()->metadata->metatype() == Class::STRING;
+}
+
+Data *fold_number_operation(Node::Command command, double lvalue, double rvalue) {
+	switch (command) {
+	case Node::ADD_OP:
+		return GarbageCollector::instance().alloc<Number>(lvalue + rvalue);
+	case Node::SUB_OP:
+		return GarbageCollector::instance().alloc<Number>(lvalue - rvalue);
+	case Node::MUL_OP:
+		return GarbageCollector::instance().alloc<Number>(lvalue * rvalue);
+	case Node::DIV_OP:
+		return GarbageCollector::instance().alloc<Number>(lvalue / rvalue);
+	case Node::POW_OP:
+		return GarbageCollector::instance().alloc<Number>(pow(lvalue, rvalue));
+	case Node::EQ_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue == rvalue);
+	case Node::NE_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue != rvalue);
+	case Node::LT_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue < rvalue);
+	case Node::GT_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue > rvalue);
+	case Node::LE_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue <= rvalue);
+	case Node::GE_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue >= rvalue);
+	default:
+		return nullptr;
+	}
+}
+
+Data *fold_boolean_operation(Node::Command command, bool lvalue, bool rvalue) {
+	switch (command) {
+	case Node::EQ_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue == rvalue);
+	case Node::NE_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue != rvalue);
+	default:
+		return nullptr;
+	}
+}
+
+Data *make_string(std::string &&str) {
+	auto *string = GarbageCollector::instance().alloc<String>(std::move(str));
+	string->construct();
+	return string;
+}
+
+Data *fold_string_operation(Node::Command command, const std::string &lvalue, const std::string &rvalue) {
+	switch (command) {
+	case Node::ADD_OP:
+		return make_string(lvalue + rvalue);
+	case Node::EQ_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue == rvalue);
+	case Node::NE_OP:
+		return GarbageCollector::instance().alloc<Boolean>(lvalue != rvalue);
+	default:
+		return nullptr;
+	}
+}
+
+}
+
+void mint::optimize_nodes(Module *module, size_t begin, size_t end) {
+	fuse_superinstructions(module, begin, end);
+}
+
+/*
+ * Folding is only performed on builtin types whose operators can not be
+ * overloaded by a script and only when both operands have the same type, so
+ * the result is the one the processor would have computed. Other operations
+ * (modulo, bitwise operators, implicit conversions, ...) are left to the
+ * processor.
+ */
+Data *mint::fold_operation(Node::Command command, const Reference &value) {
+	switch (value.data()->format) {
+	case Data::FMT_NUMBER:
+		switch (command) {
+		case Node::NOT_OP:
+			return GarbageCollector::instance().alloc<Boolean>(value.data<Number>()->value == 0.);
+		case Node::POS_OP:
+			return GarbageCollector::instance().alloc<Number>(+value.data<Number>()->value);
+		case Node::NEG_OP:
+			return GarbageCollector::instance().alloc<Number>(-value.data<Number>()->value);
+		default:
+			return nullptr;
+		}
+	case Data::FMT_BOOLEAN:
+		if (command == Node::NOT_OP) {
+			return GarbageCollector::instance().alloc<Boolean>(!value.data<Boolean>()->value);
+		}
+		return nullptr;
+	default:
+		return nullptr;
+	}
+}
+
+Data *mint::fold_operation(Node::Command command, const Reference &lvalue, const Reference &rvalue) {
+	if (lvalue.data()->format != rvalue.data()->format) {
+		return nullptr;
+	}
+	switch (lvalue.data()->format) {
+	case Data::FMT_NUMBER:
+		return fold_number_operation(command, lvalue.data<Number>()->value, rvalue.data<Number>()->value);
+	case Data::FMT_BOOLEAN:
+		return fold_boolean_operation(command, lvalue.data<Boolean>()->value, rvalue.data<Boolean>()->value);
+	case Data::FMT_OBJECT:
+		if (is_string(lvalue) && is_string(rvalue)) {
+			return fold_string_operation(command, lvalue.data<String>()->str, rvalue.data<String>()->str);
+		}
+		return nullptr;
+	default:
+		return nullptr;
+	}
+}
+
+std::optional<bool> mint::fold_condition(const Reference &value) {
+	switch (value.data()->format) {
+	case Data::FMT_NUMBER:
+		return value.data<Number>()->value != 0.;
+	case Data::FMT_BOOLEAN:
+		return value.data<Boolean>()->value;
+	default:
+		return std::nullopt;
+	}
+}
@@ -1030,6 +1030,7 @@ case_symbol_rule:
 	| case_symbol_rule DOT_TOKEN SYMBOL_TOKEN {
 		context->push_node(Node::LOAD_MEMBER);
 		context->push_node($3.c_str());
+		context->push_member_cache();
 		$$ = $1 + $2 + $3;
 	};
 
@@ -1934,6 +1935,7 @@ call_member_arg_start_rule:
     SYMBOL_TOKEN OPEN_PARENTHESIS_TOKEN {
 		context->push_node(Node::INIT_MEMBER_CALL);
 		context->push_node($1.c_str());
+		context->push_member_cache();
 		context->start_call();
 	}
 	| operator_desc_rule OPEN_PARENTHESIS_TOKEN {
@@ -2125,6 +2127,7 @@ member_ident_rule:
     expr_rule DOT_TOKEN SYMBOL_TOKEN {
 		context->push_node(Node::LOAD_MEMBER);
 		context->push_node($3.c_str());
+		context->push_member_cache();
 	}
 	| expr_rule DOT_TOKEN operator_desc_rule {
 		context->push_node(Node::LOAD_OPERATOR);
@@ -259,6 +259,7 @@ void mint::dump_command(size_t offset, Node::Command command, Cursor *cursor, st
 	case Node::LOAD_MEMBER:
 		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LOAD_MEMBER";
 		stream << " " << cursor->next().symbol->str();
+		((void)cursor->next());
 		break;
 	case Node::LOAD_OPERATOR:
 		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LOAD_OPERATOR";
@@ -599,6 +600,7 @@ void mint::dump_command(size_t offset, Node::Command command, Cursor *cursor, st
 	case Node::INIT_MEMBER_CALL:
 		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "INIT_MEMBER_CALL";
 		stream << " " << cursor->next().symbol->str();
+		((void)cursor->next());
 		break;
 	case Node::INIT_OPERATOR_CALL:
 		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "INIT_OPERATOR_CALL";
@@ -633,6 +635,121 @@ void mint::dump_command(size_t offset, Node::Command command, Cursor *cursor, st
 	case Node::EXIT_MODULE:
 		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "EXIT_MODULE";
 		break;
+	case Node::LOAD_FAST_LOAD_FAST:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LOAD_FAST_LOAD_FAST";
+		stream << " " << cursor->next().symbol->str();
+		stream << " " << cursor->next().parameter;
+		((void)cursor->next());
+		stream << " " << cursor->next().symbol->str();
+		stream << " " << cursor->next().parameter;
+		break;
+	case Node::LOAD_FAST_LOAD_CONSTANT:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LOAD_FAST_LOAD_CONSTANT";
+		stream << " " << cursor->next().symbol->str();
+		stream << " " << cursor->next().parameter;
+		((void)cursor->next());
+		stream << " " << constant_to_string(cursor, cursor->next().constant);
+		break;
+	case Node::LOAD_FAST_LOAD_MEMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LOAD_FAST_LOAD_MEMBER";
+		stream << " " << cursor->next().symbol->str();
+		stream << " " << cursor->next().parameter;
+		((void)cursor->next());
+		stream << " " << cursor->next().symbol->str();
+		((void)cursor->next());
+		break;
+	case Node::ADD_OP_MOVE_OP:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "ADD_OP_MOVE_OP";
+		((void)cursor->next());
+		break;
+	case Node::SUB_OP_MOVE_OP:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "SUB_OP_MOVE_OP";
+		((void)cursor->next());
+		break;
+	case Node::MUL_OP_MOVE_OP:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "MUL_OP_MOVE_OP";
+		((void)cursor->next());
+		break;
+	case Node::MOVE_OP_UNLOAD_REFERENCE:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "MOVE_OP_UNLOAD_REFERENCE";
+		((void)cursor->next());
+		break;
+	case Node::EQ_OP_JUMP_ZERO:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "EQ_OP_JUMP_ZERO";
+		((void)cursor->next());
+		stream << " " << offset_to_string(cursor->next().parameter);
+		break;
+	case Node::NE_OP_JUMP_ZERO:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "NE_OP_JUMP_ZERO";
+		((void)cursor->next());
+		stream << " " << offset_to_string(cursor->next().parameter);
+		break;
+	case Node::LT_OP_JUMP_ZERO:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LT_OP_JUMP_ZERO";
+		((void)cursor->next());
+		stream << " " << offset_to_string(cursor->next().parameter);
+		break;
+	case Node::GT_OP_JUMP_ZERO:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "GT_OP_JUMP_ZERO";
+		((void)cursor->next());
+		stream << " " << offset_to_string(cursor->next().parameter);
+		break;
+	case Node::LE_OP_JUMP_ZERO:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LE_OP_JUMP_ZERO";
+		((void)cursor->next());
+		stream << " " << offset_to_string(cursor->next().parameter);
+		break;
+	case Node::GE_OP_JUMP_ZERO:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "GE_OP_JUMP_ZERO";
+		((void)cursor->next());
+		stream << " " << offset_to_string(cursor->next().parameter);
+		break;
+	case Node::INIT_MEMBER_CALL_MEMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "INIT_MEMBER_CALL_MEMBER";
+		stream << " " << cursor->next().symbol->str();
+		((void)cursor->next());
+		((void)cursor->next());
+		stream << " " << cursor->next().parameter;
+		break;
+	case Node::ADD_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "ADD_NUMBER_NUMBER";
+		break;
+	case Node::SUB_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "SUB_NUMBER_NUMBER";
+		break;
+	case Node::MUL_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "MUL_NUMBER_NUMBER";
+		break;
+	case Node::DIV_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "DIV_NUMBER_NUMBER";
+		break;
+	case Node::EQ_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "EQ_NUMBER_NUMBER";
+		break;
+	case Node::NE_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "NE_NUMBER_NUMBER";
+		break;
+	case Node::LT_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LT_NUMBER_NUMBER";
+		break;
+	case Node::GT_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "GT_NUMBER_NUMBER";
+		break;
+	case Node::LE_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "LE_NUMBER_NUMBER";
+		break;
+	case Node::GE_NUMBER_NUMBER:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "GE_NUMBER_NUMBER";
+		break;
+	case Node::ADD_STRING_STRING:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "ADD_STRING_STRING";
+		break;
+	case Node::EQ_STRING_STRING:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "EQ_STRING_STRING";
+		break;
+	case Node::NE_STRING_STRING:
+		stream << std::setiosflags(std::stringstream::left) << std::setw(32) << "NE_STRING_STRING";
+		break;
 	}
 
 	stream << '\n';
@@ -80,15 +80,6 @@ Array &Array::operator=(const Array &other) {
 	return *this;
 }
 
-void Array::mark() {
-	if (!marked_bit()) {
-		Object::mark();
-		for (values_type::value_type &item : values) {
-			item.data()->mark();
-		}
-	}
-}
-
 ArrayClass::ArrayClass() :
 	Class("array", Class::ARRAY) {
 
@@ -69,16 +69,6 @@ Hash &Hash::operator=(const Hash &other) {
 	return *this;
 }
 
-void Hash::mark() {
-	if (!marked_bit()) {
-		Object::mark();
-		for (auto &[key, value] : values) {
-			key.data()->mark();
-			value.data()->mark();
-		}
-	}
-}
-
 HashClass::HashClass() :
 	Class("hash", Class::HASH) {
 
@@ -93,13 +93,6 @@ Iterator *Iterator::from_exclusive_range(double begin, double end) {
 	return GarbageCollector::instance().alloc<Iterator>(new mint::internal::RangeIteratorData(begin, end));
 }
 
-void Iterator::mark() {
-	if (!marked_bit()) {
-		Object::mark();
-		ctx.mark();
-	}
-}
-
 IteratorClass::IteratorClass() :
 	Class("iterator", Class::ITERATOR) {
 
@@ -307,7 +300,7 @@ Iterator *mint::iterator_init(Reference &ref) {
 		return ref.data<Iterator>();
 	}
 
-	auto *iterator = new Iterator(ref);
+	auto *iterator = GarbageCollector::instance().alloc<Iterator>(ref);
 	iterator->construct();
 	return iterator;
 }
@@ -318,7 +311,7 @@ Iterator *mint::iterator_init(Reference &&ref) {
 		return ref.data<Iterator>();
 	}
 
-	auto *iterator = new Iterator(std::move(ref));
+	auto *iterator = GarbageCollector::instance().alloc<Iterator>(std::move(ref));
 	iterator->construct();
 	return iterator;
 }
@@ -25,6 +25,7 @@
 #include "mint/memory/object.h"
 #include "mint/memory/globaldata.h"
 #include "mint/memory/memorytool.h"
+#include "mint/memory/membercache.h"
 
 using namespace mint;
 
@@ -91,6 +92,7 @@ Class::Class(PackageData *package, std::string name, Metatype metatype) :
 }
 
 Class::~Class() {
+	MemberCache::invalidate_all();
 	for (const auto &member : m_members) {
 		delete member.second;
 	}
@@ -172,6 +174,8 @@ void Class::disable_copy() {
 
 void Class::cleanup_memory() {
 
+	MemberCache::invalidate_all();
+
 	for (const auto &member : m_members) {
 		delete member.second;
 	}
@@ -193,6 +197,8 @@ void Class::cleanup_memory() {
 
 void Class::cleanup_metadata() {
 
+	MemberCache::invalidate_all();
+
 	for (const auto &member : m_globals) {
 		delete member.second;
 	}
@@ -33,11 +33,7 @@ Data::Data(Format fmt) :
 }
 
 void Data::mark() {
-	infos.reachable = true;
-}
-
-bool Data::marked_bit() const {
-	return infos.reachable;
+	GarbageCollector::instance().mark(this);
 }
 
 None::None() :
@@ -29,11 +29,19 @@
 #include "mint/memory/builtin/string.h"
 #include "mint/memory/operatortool.h"
 #include "mint/memory/globaldata.h"
+#include "mint/memory/garbagecollector.h"
 #include "mint/scheduler/scheduler.h"
+#include "mint/scheduler/processor.h"
 #include "mint/system/bufferstream.h"
 #include "mint/compiler/compiler.h"
 #include "mint/ast/cursor.h"
 
+#ifdef OS_WINDOWS
+#include <Windows.h>
+#endif
+
+#include <cerrno>
+
 using namespace mint;
 
 ReferenceHelper::ReferenceHelper(const FunctionHelper *function, Reference &&reference) :
@@ -114,6 +122,58 @@ void FunctionHelper::return_value(Reference &&value) {
 	m_value_returned = true;
 }
 
+FunctionHelper::BlockingRegion FunctionHelper::blocking_region(PinnedReferences pinned) const {
+	return BlockingRegion(pinned);
+}
+
+FunctionHelper::BlockingRegion FunctionHelper::blocking_region(const std::vector<WeakReference> &pinned) const {
+	return BlockingRegion(pinned);
+}
+
+FunctionHelper::BlockingRegion::BlockingRegion(PinnedReferences pinned) {
+
+	// references used during the region must stay alive while other threads can run the
+	// garbage collector, they are registered as roots before the lock is released
+	m_pinned.reserve(pinned.size());
+	for (const Reference &reference : pinned) {
+		m_pinned.emplace_back(StrongReference::copy(reference));
+	}
+
+	// the other references of the native frames are only kept by their reference count,
+	// the full collections started meanwhile keep any data referenced from outside of the heap
+	GarbageCollector::instance().enter_blocking_region();
+	unlock_processor();
+}
+
+FunctionHelper::BlockingRegion::BlockingRegion(const std::vector<WeakReference> &pinned) {
+
+	m_pinned.reserve(pinned.size());
+	for (const Reference &reference : pinned) {
+		m_pinned.emplace_back(StrongReference::copy(reference));
+	}
+
+	GarbageCollector::instance().enter_blocking_region();
+	unlock_processor();
+}
+
+FunctionHelper::BlockingRegion::~BlockingRegion() {
+
+	// the error of the blocking call is still needed once the lock is acquired again
+#ifdef OS_WINDOWS
+	const DWORD last_error = GetLastError();
+	const int saved_errno = errno;
+	lock_processor();
+	GarbageCollector::instance().leave_blocking_region();
+	SetLastError(last_error);
+	errno = saved_errno;
+#else
+	const int saved_errno = errno;
+	lock_processor();
+	GarbageCollector::instance().leave_blocking_region();
+	errno = saved_errno;
+#endif
+}
+
 WeakReference mint::create_function(Module::Info &module, int signature, const std::string &function) {
 
 	BufferStream stream(function);
@@ -137,6 +197,10 @@ WeakReference mint::create_boolean(bool value) {
 	return WeakReference::create<Boolean>(value);
 }
 
+WeakReference mint::share_boolean(bool value) {
+	return WeakReference::share(*GlobalData::instance()->boolean_ref(value));
+}
+
 WeakReference mint::create_string(const char *value) {
 	WeakReference ref = WeakReference::create<String>(value);
 	ref.data<String>()->construct();
@@ -33,7 +33,20 @@
 #include "mint/memory/object.h"
 #include "mint/scheduler/scheduler.h"
 
-#include <list>
+#include <algorithm>
+#include <condition_variable>
+#include <csignal>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#ifdef OS_UNIX
+#include <pthread.h>
+#endif
 
 using namespace mint;
 
@@ -62,21 +75,360 @@ using namespace mint;
 	}
 
 GarbageCollector &MemoryRoot::g_garbage_collector = GarbageCollector::instance();
+std::atomic_bool GarbageCollector::g_heap_profile_requested = false;
+
+HeapPool<Number> Number::g_pool;
+HeapPool<Boolean> Boolean::g_pool;
+HeapPool<Object> Object::g_pool;
+HeapPool<String> String::g_pool;
+HeapPool<Regex> Regex::g_pool;
+HeapPool<Array> Array::g_pool;
+HeapPool<Hash> Hash::g_pool;
+HeapPool<Iterator> Iterator::g_pool;
+HeapPool<Library> Library::g_pool;
+HeapPool<Package> Package::g_pool;
+HeapPool<Function> Function::g_pool;
+
+namespace {
+
+/*
+ * Calls visitor with each reference held by data. A reference that is not
+ * visited is seen as an external reference when the internal references are
+ * counted, which keeps the target alive.
+ */
+template<class Visitor>
+void visit_references(Data *data, Visitor &&visitor) {
+	switch (data->format) {
+	case Data::FMT_OBJECT:
+		{
+			auto *object = static_cast<Object *>(data);
+			if (object->data) {
+				for (size_t offset = 0; offset < object->metadata->size(); ++offset) {
+					visitor(object->data[offset]);
+				}
+			}
+			switch (object->metadata->metatype()) {
+			case Class::ARRAY:
+				for (const WeakReference &item : static_cast<Array *>(object)->values) {
+					visitor(item);
+				}
+				break;
+			case Class::HASH:
+				for (const auto &[key, value] : static_cast<Hash *>(object)->values) {
+					visitor(key);
+					visitor(value);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		break;
+	case Data::FMT_FUNCTION:
+		for (const auto &signature : static_cast<Function *>(data)->mapping) {
+			if (const auto &capture = signature.second.capture) {
+				for (const auto &reference : *capture) {
+					visitor(reference.second);
+				}
+			}
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+using DataCounter = std::uint64_t GarbageCollectorStatistics::DataStatistics::*;
+
+/*
+ * Counts a data of the given slot size in the statistics of its format and of
+ * its metatype for objects.
+ */
+void count_data(GarbageCollectorStatistics &statistics, const Data *data, size_t bytes, DataCounter objects,
+				DataCounter size) {
+	GarbageCollectorStatistics::DataStatistics &format = statistics.formats[data->format];
+	++(format.*objects);
+	format.*size += bytes;
+	if (data->format == Data::FMT_OBJECT) {
+		GarbageCollectorStatistics::DataStatistics &metatype =
+			statistics.metatypes[static_cast<const Object *>(data)->metadata->metatype()];
+		++(metatype.*objects);
+		metatype.*size += bytes;
+	}
+}
+
+void merge_data_statistics(GarbageCollectorStatistics::DataStatistics &statistics,
+						   const GarbageCollectorStatistics::DataStatistics &other) {
+	statistics.marked_objects += other.marked_objects;
+	statistics.marked_bytes += other.marked_bytes;
+	statistics.swept_objects += other.swept_objects;
+	statistics.swept_bytes += other.swept_bytes;
+}
+
+/*
+ * Adds the data marked and swept by a collector thread to the statistics of
+ * the collector.
+ */
+void merge_statistics(GarbageCollectorStatistics &statistics, const GarbageCollectorStatistics &other) {
+	for (size_t format = 0; format < GarbageCollectorStatistics::FORMAT_COUNT; ++format) {
+		merge_data_statistics(statistics.formats[format], other.formats[format]);
+	}
+	for (size_t metatype = 0; metatype < GarbageCollectorStatistics::METATYPE_COUNT; ++metatype) {
+		merge_data_statistics(statistics.metatypes[metatype], other.metatypes[metatype]);
+	}
+}
+
+}
+
+static_assert(GarbageCollectorStatistics::METATYPE_COUNT == Class::BUILTIN_CLASS_COUNT);
+
+static constexpr const char *COLLECTION_THRESHOLD_VAR = "MINT_GC_THRESHOLD";
+static constexpr const char *COLLECTION_GROWTH_VAR = "MINT_GC_GROWTH";
+static constexpr const char *COLLECTION_SLICE_VAR = "MINT_GC_SLICE";
+static constexpr const char *COLLECTION_THREADS_VAR = "MINT_GC_THREADS";
+static constexpr const char *RECLAIM_DELAY_VAR = "MINT_GC_RECLAIM_DELAY";
+static constexpr const char *HEAP_PROFILE_VAR = "MINT_HEAP_PROFILE";
+static constexpr const char *HEAP_PROFILE_INTERVAL_VAR = "MINT_HEAP_PROFILE_INTERVAL";
+static constexpr const size_t COLLECTION_SLICE_STEPS = 64;
+static constexpr const size_t COLLECTION_SLICE_PAGES = 4;
+static constexpr const size_t PARALLEL_COLLECTION_PAGES = 16;
+static constexpr const size_t MARK_WORKER_BATCH = 64;
+static constexpr const std::chrono::seconds COLLECTION_THREAD_IDLE_TIMEOUT(1);
+
+/*
+ * Runs a job on the collector threads. The calling thread takes part in the
+ * job as the worker of index 0 and returns once every worker is done. The
+ * threads are started on demand and stop once they were idle for a while.
+ */
+class GarbageCollector::WorkerPool {
+public:
+	explicit WorkerPool(size_t count) :
+		m_threads(count - 1),
+		m_started(count - 1, false) {}
+
+	WorkerPool(WorkerPool &&) = delete;
+	WorkerPool(const WorkerPool &) = delete;
+
+	~WorkerPool() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_stopping = true;
+		m_start.notify_all();
+		lock.unlock();
+		for (std::thread &thread : m_threads) {
+			if (thread.joinable()) {
+				thread.join();
+			}
+		}
+	}
+
+	WorkerPool &operator=(WorkerPool &&) = delete;
+	WorkerPool &operator=(const WorkerPool &) = delete;
+
+	[[nodiscard]] size_t size() const {
+		return m_threads.size() + 1;
+	}
+
+	void run(const std::function<void(size_t)> &job) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (size_t index = 0; index < m_threads.size(); ++index) {
+			if (!m_started[index]) {
+				// a thread that stopped has released the lock before it can be joined
+				if (m_threads[index].joinable()) {
+					m_threads[index].join();
+				}
+				m_threads[index] = std::thread(&WorkerPool::main, this, index + 1, m_generation);
+				m_started[index] = true;
+			}
+		}
+		m_job = &job;
+		m_running = m_threads.size();
+		++m_generation;
+		m_start.notify_all();
+		lock.unlock();
+		job(0);
+		lock.lock();
+		m_done.wait(lock, [this] {
+			return m_running == 0;
+		});
+		m_job = nullptr;
+	}
+
+private:
+	void main(size_t index, size_t generation) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (;;) {
+			if (!m_start.wait_for(lock, COLLECTION_THREAD_IDLE_TIMEOUT, [this, generation] {
+					return m_stopping || m_generation != generation;
+				})) {
+				m_started[index - 1] = false;
+				return;
+			}
+			if (m_stopping) {
+				return;
+			}
+			generation = m_generation;
+			const std::function<void(size_t)> *job = m_job;
+			lock.unlock();
+			(*job)(index);
+			lock.lock();
+			if (--m_running == 0) {
+				m_done.notify_one();
+			}
+		}
+	}
+
+	std::vector<std::thread> m_threads;
+	std::vector<bool> m_started;
+	std::mutex m_mutex;
+	std::condition_variable m_start;
+	std::condition_variable m_done;
+	const std::function<void(size_t)> *m_job = nullptr;
+	size_t m_generation = 0;
+	size_t m_running = 0;
+	bool m_stopping = false;
+};
+
+namespace {
+
+/*
+ * Marks data from a private stack. The data published in the shared stack can
+ * be stolen by the idle workers.
+ */
+struct MarkWorker {
+	std::vector<Data *> local;
+	std::vector<Data *> shared;
+	std::atomic_size_t shared_size = 0;
+	std::mutex mutex;
+	GarbageCollectorStatistics statistics = {};
+
+	void shade(Data *data) {
+		if (!HeapPage::of(data)->marked.test_and_set(HeapPage::granule(data))) {
+			local.emplace_back(data);
+		}
+	}
+
+	void shade_later(Data *data) {
+		PREFETCH(data);
+		shade(data);
+	}
+
+	void publish() {
+		std::unique_lock<std::mutex> lock(mutex);
+		const size_t count = local.size() / 2;
+		shared.insert(shared.end(), local.begin(), local.begin() + static_cast<std::ptrdiff_t>(count));
+		local.erase(local.begin(), local.begin() + static_cast<std::ptrdiff_t>(count));
+		shared_size = shared.size();
+	}
+
+	bool take(std::vector<Data *> &stack, size_t count) {
+		std::unique_lock<std::mutex> lock(mutex);
+		if (shared.empty()) {
+			return false;
+		}
+		count = std::min(std::max<size_t>(count, 1), shared.size());
+		stack.insert(stack.end(), shared.end() - static_cast<std::ptrdiff_t>(count), shared.end());
+		shared.resize(shared.size() - count);
+		shared_size = shared.size();
+		return true;
+	}
+
+	bool reclaim() {
+		return take(local, std::numeric_limits<size_t>::max());
+	}
+
+	bool steal(MarkWorker &victim) {
+		return victim.take(local, (victim.shared_size.load(std::memory_order_relaxed) + 1) / 2);
+	}
+};
+
+thread_local MarkWorker *g_mark_worker = nullptr;
+
+}
+
+// the heap is created before the collector, so it is destroyed after it
+GarbageCollector::GarbageCollector() :
+	m_heap(Heap::instance()) {
+
+	if (const char *var = getenv(COLLECTION_THRESHOLD_VAR)) {
+		char *end = nullptr;
+		const unsigned long long count = strtoull(var, &end, 10);
+		if (end != var && *end == '\0') {
+			m_collection_threshold = static_cast<size_t>(count);
+		}
+	}
+
+	if (const char *var = getenv(COLLECTION_GROWTH_VAR)) {
+		char *end = nullptr;
+		const double ratio = strtod(var, &end);
+		if (end != var && *end == '\0' && ratio >= 1.) {
+			m_collection_growth = ratio;
+		}
+	}
+
+	if (const char *var = getenv(COLLECTION_SLICE_VAR)) {
+		char *end = nullptr;
+		const unsigned long long budget = strtoull(var, &end, 10);
+		if (end != var && *end == '\0') {
+			m_collection_slice = std::chrono::microseconds(budget);
+		}
+	}
+
+	m_collection_threads = std::max(1u, std::thread::hardware_concurrency());
+
+	if (const char *var = getenv(COLLECTION_THREADS_VAR)) {
+		char *end = nullptr;
+		const unsigned long long count = strtoull(var, &end, 10);
+		if (end != var && *end == '\0' && count >= 1) {
+			m_collection_threads = static_cast<size_t>(count);
+		}
+	}
 
-LocalPool<Number> Number::g_pool;
-LocalPool<Boolean> Boolean::g_pool;
-LocalPool<Object> Object::g_pool;
-LocalPool<String> String::g_pool;
-LocalPool<Regex> Regex::g_pool;
-LocalPool<Array> Array::g_pool;
-LocalPool<Hash> Hash::g_pool;
-LocalPool<Iterator> Iterator::g_pool;
-LocalPool<Library> Library::g_pool;
-LocalPool<Package> Package::g_pool;
-LocalPool<Function> Function::g_pool;
+	if (const char *var = getenv(RECLAIM_DELAY_VAR)) {
+		char *end = nullptr;
+		const unsigned long long count = strtoull(var, &end, 10);
+		if (end != var && *end == '\0') {
+			m_reclaim_delay = static_cast<size_t>(count);
+		}
+	}
+
+	// the profiles are written next to the given path when the process gets
+	// the SIGUSR2 signal
+	if (const char *var = getenv(HEAP_PROFILE_VAR)) {
+		size_t sampling_interval = HeapProfiler::DEFAULT_SAMPLING_INTERVAL;
+		if (const char *interval_var = getenv(HEAP_PROFILE_INTERVAL_VAR)) {
+			char *end = nullptr;
+			const unsigned long long interval = strtoull(interval_var, &end, 10);
+			if (end != interval_var && *end == '\0' && interval > 0) {
+				sampling_interval = static_cast<size_t>(interval);
+			}
+		}
+		m_heap_profile_path = var;
+		start_heap_profiler(sampling_interval);
+#ifdef OS_UNIX
+		std::signal(SIGUSR2, [](int) {
+			GarbageCollector::request_heap_profile();
+		});
+#endif
+	}
+
+#ifdef OS_UNIX
+	// the collector threads are not copied in a forked process, the child
+	// must not wait for them on exit and starts its own threads on demand
+	pthread_atfork(nullptr, nullptr, [] {
+		GarbageCollector::instance().m_worker_pool = nullptr;
+	});
+#endif
+
+	m_next_major_collection = next_major_collection();
+}
 
 GarbageCollector::~GarbageCollector() {
+	// the collector threads are not started again during the last collections
+	m_collection_threads = 1;
+	delete m_worker_pool;
+	m_worker_pool = nullptr;
 	clean();
+	delete m_heap_profiler;
 }
 
 GarbageCollector &GarbageCollector::instance() {
@@ -87,7 +439,296 @@ GarbageCollector &GarbageCollector::instance() {
 
 size_t GarbageCollector::collect() {
 
-	std::list<Data *> collected;
+	const auto start = std::chrono::steady_clock::now();
+	const bool collecting = std::exchange(m_collecting, true);
+	const auto deadline = std::chrono::steady_clock::time_point::max();
+	size_t count = 0;
+
+	// a cycle started by the automatic collection can miss the data released
+	// since its start, a new cycle is needed to get them
+	if (m_phase != IDLE) {
+		while (m_phase == MARKING && !mark_slice(deadline)) {}
+		while (!sweep_slice(deadline)) {}
+		count += finish_cycle();
+	}
+
+	start_cycle();
+	while (!mark_slice(deadline)) {}
+	while (!sweep_slice(deadline)) {}
+	count += finish_cycle();
+
+	m_collecting = collecting;
+	record_pause(start);
+	return count;
+}
+
+bool GarbageCollector::collect_incrementally(std::chrono::microseconds budget) {
+
+	const auto start = std::chrono::steady_clock::now();
+	const bool collecting = std::exchange(m_collecting, true);
+	const auto deadline = budget == std::chrono::microseconds::max() ? std::chrono::steady_clock::time_point::max()
+																	 : start + budget;
+
+	if (m_phase == IDLE) {
+		start_cycle();
+	}
+
+	bool finished = false;
+
+	if (m_phase == SWEEPING || mark_slice(deadline)) {
+		if (sweep_slice(deadline)) {
+			finish_cycle();
+			finished = true;
+		}
+	}
+
+	m_collecting = collecting;
+	record_pause(start);
+	return finished;
+}
+
+size_t GarbageCollector::collect_young() {
+
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<Data *> collected;
+	const bool collecting = std::exchange(m_collecting, true);
+
+	// only the pages holding young data are visited
+	const std::unordered_map<Data *, size_t> internal_references =
+		count_internal_references(m_young_pages, &HeapPage::young, is_young);
+
+	// any other reference comes from a stack, a root, a native frame or the old
+	// generation, so the data is alive
+	std::vector<Data *> pending;
+	for (HeapPage *page : m_young_pages) {
+		for (size_t index = 0; index < HeapPage::Bitmap::WORD_COUNT; ++index) {
+			page->marked.words[index] &= ~page->young.words[index];
+		}
+		page->for_each(page->young, [&](void *address) {
+			auto *data = static_cast<Data *>(address);
+			auto i = internal_references.find(data);
+			if (i == internal_references.end() || i->second < data->infos.refcount) {
+				page->marked.set(HeapPage::granule(data));
+				pending.emplace_back(data);
+			}
+		});
+	}
+
+	while (!pending.empty()) {
+		Data *data = pending.back();
+		pending.pop_back();
+		count_data(m_statistics, data, HeapPage::of(data)->slot_size, &GarbageCollectorStatistics::DataStatistics::marked_objects,
+				   &GarbageCollectorStatistics::DataStatistics::marked_bytes);
+		visit_references(data, [&pending](const Reference &reference) {
+			Data *target = reference.m_info->data;
+			HeapPage *page = HeapPage::of(target);
+			const size_t granule = HeapPage::granule(target);
+			if (page->young.test(granule) && !page->marked.test(granule)) {
+				page->marked.set(granule);
+				pending.emplace_back(target);
+			}
+		});
+	}
+
+	// sweep
+	for (HeapPage *page : m_young_pages) {
+		for (size_t index = 0; index < HeapPage::Bitmap::WORD_COUNT; ++index) {
+			std::uint64_t &young = page->young.words[index];
+			std::uint64_t &marked = page->marked.words[index];
+			for (std::uint64_t garbage = young & ~marked; garbage; garbage &= garbage - 1) {
+				auto *data = static_cast<Data *>(
+					page->address(index * HeapPage::Bitmap::WORD_BITS + HeapPage::Bitmap::lowest_bit(garbage)));
+				data->infos.collected = true;
+				count_data(m_statistics, data, page->slot_size, &GarbageCollectorStatistics::DataStatistics::swept_objects,
+						   &GarbageCollectorStatistics::DataStatistics::swept_bytes);
+				collected.emplace_back(data);
+				--m_young_count;
+			}
+			page->allocated.words[index] &= ~young | marked;
+			marked &= ~young;
+		}
+	}
+
+	promote_young_generation();
+	++m_statistics.young_collections;
+
+	dispose(collected);
+
+	m_collecting = collecting;
+	record_pause(start);
+	return collected.size();
+}
+
+void GarbageCollector::clean() {
+
+	assert(m_stacks.empty());
+	assert(m_roots.head == nullptr);
+
+	while (collect() > 0) {
+		;
+	}
+
+	assert(m_young_count == 0);
+	assert(m_old_count == 0);
+}
+
+void GarbageCollector::set_collection_threshold(size_t count) {
+	m_collection_threshold = count;
+	m_next_major_collection = next_major_collection();
+}
+
+size_t GarbageCollector::collection_threshold() const {
+	return m_collection_threshold;
+}
+
+void GarbageCollector::set_collection_growth(double ratio) {
+	assert(ratio >= 1.);
+	m_collection_growth = ratio;
+	m_next_major_collection = next_major_collection();
+}
+
+double GarbageCollector::collection_growth() const {
+	return m_collection_growth;
+}
+
+void GarbageCollector::set_collection_slice(std::chrono::microseconds budget) {
+	m_collection_slice = budget;
+}
+
+std::chrono::microseconds GarbageCollector::collection_slice() const {
+	return m_collection_slice;
+}
+
+void GarbageCollector::set_collection_threads(size_t count) {
+	assert(count >= 1);
+	m_collection_threads = count;
+}
+
+size_t GarbageCollector::collection_threads() const {
+	return m_collection_threads;
+}
+
+void GarbageCollector::set_reclaim_delay(size_t count) {
+	m_reclaim_delay = count;
+}
+
+size_t GarbageCollector::reclaim_delay() const {
+	return m_reclaim_delay;
+}
+
+bool GarbageCollector::collect_if_requested() {
+
+	if (UNLIKELY(g_heap_profile_requested.load(std::memory_order_relaxed))) {
+		g_heap_profile_requested = false;
+		dump_heap_profile();
+	}
+
+	// data referenced only by the native frames of a nested process are not
+	// visible from the roots, the collection must wait for these frames
+	if (m_collecting || m_suspended_collections || !collection_requested()) {
+		return false;
+	}
+
+	// a budget of zero disables the incremental collection
+	const auto budget = m_collection_slice.count() ? m_collection_slice : std::chrono::microseconds::max();
+
+	if (m_phase != IDLE) {
+		collect_incrementally(budget);
+		return true;
+	}
+
+	collect_young();
+
+	if (m_old_count >= m_next_major_collection) {
+		collect_incrementally(budget);
+	}
+
+	return true;
+}
+
+GarbageCollectorStatistics GarbageCollector::statistics() const {
+
+	GarbageCollectorStatistics statistics = m_statistics;
+	statistics.young_objects = m_young_count;
+	statistics.old_objects = m_old_count;
+	for (MemoryRoot *root = m_roots.head; root != nullptr; root = root->next) {
+		++statistics.roots;
+	}
+	statistics.stacks = m_stacks.size();
+	statistics.heap_pages = m_heap.pages().size();
+	statistics.heap_bytes = statistics.heap_pages * HeapPage::SIZE;
+	statistics.reference_infos = Reference::g_pool.count();
+	statistics.reference_info_chunks = Reference::g_pool.chunk_count();
+
+	// the live data are counted from the heap when requested
+	for (HeapPage *page : m_heap.pages()) {
+		page->for_each(page->allocated, [&statistics, page](void *address) {
+			count_data(statistics, static_cast<Data *>(address), page->slot_size,
+					   &GarbageCollectorStatistics::DataStatistics::live_objects,
+					   &GarbageCollectorStatistics::DataStatistics::live_bytes);
+		});
+	}
+
+	return statistics;
+}
+
+void GarbageCollector::start_heap_profiler(size_t sampling_interval) {
+	delete m_heap_profiler;
+	m_heap_profiler = new HeapProfiler(sampling_interval);
+	m_bytes_until_sample = m_heap_profiler->next_sample();
+}
+
+void GarbageCollector::stop_heap_profiler() {
+	delete m_heap_profiler;
+	m_heap_profiler = nullptr;
+	m_bytes_until_sample = std::numeric_limits<size_t>::max();
+}
+
+HeapProfiler *GarbageCollector::heap_profiler() const {
+	return m_heap_profiler;
+}
+
+void GarbageCollector::request_heap_profile() {
+	g_heap_profile_requested = true;
+}
+
+void GarbageCollector::suspend_automatic_collection() {
+	++m_suspended_collections;
+}
+
+void GarbageCollector::resume_automatic_collection() {
+	assert(m_suspended_collections);
+	--m_suspended_collections;
+}
+
+void GarbageCollector::enter_blocking_region() {
+	++m_blocking_regions;
+}
+
+void GarbageCollector::leave_blocking_region() {
+	assert(m_blocking_regions);
+	--m_blocking_regions;
+}
+
+void GarbageCollector::start_cycle() {
+
+	assert(m_phase == IDLE);
+	assert(m_grey.empty());
+	m_phase = MARKING;
+
+	for (HeapPage *page : m_heap.pages()) {
+		page->marked.clear();
+	}
+
+	// data that are not referenced yet are kept with everything they refer to
+	for (HeapPage *page : m_heap.pages()) {
+		page->for_each(page->allocated, [](void *address) {
+			auto *data = static_cast<Data *>(address);
+			if (data->infos.refcount == 0) {
+				data->mark();
+			}
+		});
+	}
 
 	// mark roots
 	for (MemoryRoot *root = m_roots.head; root != nullptr; root = root->next) {
@@ -101,18 +742,395 @@ size_t GarbageCollector::collect() {
 		}
 	}
 
-	// sweep
-	for (Data *data = m_memory.head; data != nullptr; data = data->next) {
-		if (data->infos.reachable) {
-			data->infos.reachable = (data->infos.refcount == 0);
+	// the native frames of a thread waiting in a blocking region are not visible
+	// from the roots, data referenced from outside of the heap are kept
+	if (m_blocking_regions) {
+		const std::unordered_map<Data *, size_t> internal_references =
+			count_internal_references(m_heap.pages(), &HeapPage::allocated, [](const Data *data) {
+				const HeapPage *page = HeapPage::of(data);
+				return page->allocated.test(HeapPage::granule(data));
+			});
+		for (HeapPage *page : m_heap.pages()) {
+			page->for_each(page->allocated, [&internal_references](void *address) {
+				auto *data = static_cast<Data *>(address);
+				auto i = internal_references.find(data);
+				if (i == internal_references.end() || i->second < data->infos.refcount) {
+					data->mark();
+				}
+			});
 		}
-		else {
+	}
+}
+
+bool GarbageCollector::mark_slice(std::chrono::steady_clock::time_point deadline) {
+
+	assert(m_phase == MARKING);
+
+	if (use_worker_pool(deadline)) {
+		mark_in_parallel();
+	}
+
+	while (!m_grey.empty()) {
+		for (size_t step = 0; step < COLLECTION_SLICE_STEPS && !m_grey.empty(); ++step) {
+			Data *data = m_grey.back();
+			m_grey.pop_back();
+			if (!m_grey.empty()) {
+				PREFETCH(m_grey.back());
+			}
+			if (data) {
+				data->infos.grey = 0;
+				count_data(m_statistics, data, HeapPage::of(data)->slot_size,
+						   &GarbageCollectorStatistics::DataStatistics::marked_objects,
+						   &GarbageCollectorStatistics::DataStatistics::marked_bytes);
+				trace(*this, data);
+			}
+		}
+		shade_pending();
+		if (!m_grey.empty() && std::chrono::steady_clock::now() >= deadline) {
+			return false;
+		}
+	}
+
+	m_phase = SWEEPING;
+	m_sweep_page = 0;
+	return true;
+}
+
+bool GarbageCollector::sweep_slice(std::chrono::steady_clock::time_point deadline) {
+
+	assert(m_phase == SWEEPING);
+
+	if (use_worker_pool(deadline)) {
+		sweep_in_parallel();
+		return true;
+	}
+
+	// pages created while sweeping only contain data allocated during the cycle
+	const std::vector<HeapPage *> &pages = m_heap.pages();
+
+	while (m_sweep_page < pages.size()) {
+		size_t young_count = 0;
+		size_t old_count = 0;
+		for (size_t step = 0; step < COLLECTION_SLICE_PAGES && m_sweep_page < pages.size(); ++step) {
+			sweep_page(pages[m_sweep_page++], m_collected, young_count, old_count, m_statistics);
+		}
+		m_young_count -= young_count;
+		m_old_count -= old_count;
+		if (m_sweep_page < pages.size() && std::chrono::steady_clock::now() >= deadline) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void GarbageCollector::sweep_page(HeapPage *page, std::vector<Data *> &collected, size_t &young_count,
+								  size_t &old_count, GarbageCollectorStatistics &statistics) {
+	for (size_t index = 0; index < HeapPage::Bitmap::WORD_COUNT; ++index) {
+		std::uint64_t &allocated = page->allocated.words[index];
+		std::uint64_t &young = page->young.words[index];
+		const std::uint64_t garbage = allocated & ~page->marked.words[index];
+		for (std::uint64_t bits = garbage; bits; bits &= bits - 1) {
+			const std::uint64_t bit = bits & (~bits + 1);
+			auto *data = static_cast<Data *>(
+				page->address(index * HeapPage::Bitmap::WORD_BITS + HeapPage::Bitmap::lowest_bit(bits)));
 			data->infos.collected = true;
-			GC_LIST_REMOVE_ELEMENT(m_memory, data);
+			count_data(statistics, data, page->slot_size, &GarbageCollectorStatistics::DataStatistics::swept_objects,
+					   &GarbageCollectorStatistics::DataStatistics::swept_bytes);
+			if (young & bit) {
+				++young_count;
+			}
+			else {
+				++old_count;
+			}
 			collected.emplace_back(data);
 		}
+		allocated &= ~garbage;
+		young &= ~garbage;
+	}
+}
+
+bool GarbageCollector::use_worker_pool(std::chrono::steady_clock::time_point deadline) const {
+	// the threads are only used when the whole phase can be done at once
+	return m_collection_threads > 1 && deadline == std::chrono::steady_clock::time_point::max()
+		   && m_heap.pages().size() >= PARALLEL_COLLECTION_PAGES;
+}
+
+GarbageCollector::WorkerPool *GarbageCollector::worker_pool() {
+	if (m_worker_pool == nullptr || m_worker_pool->size() != m_collection_threads) {
+		delete m_worker_pool;
+		m_worker_pool = new WorkerPool(m_collection_threads);
+	}
+	return m_worker_pool;
+}
+
+void GarbageCollector::mark_in_parallel() {
+
+	WorkerPool *pool = worker_pool();
+	std::vector<MarkWorker> workers(pool->size());
+	std::atomic_size_t idle = 0;
+
+	// the grey data are shared between the workers
+	shade_pending();
+	for (size_t index = 0; index < m_grey.size(); ++index) {
+		if (Data *data = m_grey[index]) {
+			data->infos.grey = 0;
+			workers[index % workers.size()].local.emplace_back(data);
+		}
+	}
+	m_grey.clear();
+
+	pool->run([&workers, &idle](size_t index) {
+		MarkWorker &worker = workers[index];
+		g_mark_worker = &worker;
+		for (;;) {
+			while (!worker.local.empty()) {
+				for (size_t step = 0; step < MARK_WORKER_BATCH && !worker.local.empty(); ++step) {
+					Data *data = worker.local.back();
+					worker.local.pop_back();
+					if (!worker.local.empty()) {
+						PREFETCH(worker.local.back());
+					}
+					count_data(worker.statistics, data, HeapPage::of(data)->slot_size,
+							   &GarbageCollectorStatistics::DataStatistics::marked_objects,
+							   &GarbageCollectorStatistics::DataStatistics::marked_bytes);
+					trace(worker, data);
+				}
+				if (idle.load(std::memory_order_relaxed) && worker.local.size() > 1) {
+					worker.publish();
+				}
+			}
+			if (worker.reclaim()) {
+				continue;
+			}
+			// the marking is finished once every worker is idle, an idle worker
+			// has no data to share
+			bool stolen = false;
+			++idle;
+			while (!stolen && idle.load() < workers.size()) {
+				for (size_t offset = 1; offset < workers.size() && !stolen; ++offset) {
+					MarkWorker &victim = workers[(index + offset) % workers.size()];
+					if (victim.shared_size.load(std::memory_order_relaxed)) {
+						--idle;
+						stolen = worker.steal(victim);
+						if (!stolen) {
+							++idle;
+						}
+					}
+				}
+				if (!stolen) {
+					std::this_thread::yield();
+				}
+			}
+			if (!stolen) {
+				break;
+			}
+		}
+		g_mark_worker = nullptr;
+	});
+
+	for (const MarkWorker &worker : workers) {
+		merge_statistics(m_statistics, worker.statistics);
+	}
+}
+
+void GarbageCollector::sweep_in_parallel() {
+
+	WorkerPool *pool = worker_pool();
+	const std::vector<HeapPage *> &pages = m_heap.pages();
+	std::atomic_size_t next_page = m_sweep_page;
+	std::mutex mutex;
+
+	pool->run([this, &pages, &next_page, &mutex](size_t) {
+		std::vector<Data *> collected;
+		GarbageCollectorStatistics statistics = {};
+		size_t young_count = 0;
+		size_t old_count = 0;
+		for (size_t index = next_page++; index < pages.size(); index = next_page++) {
+			sweep_page(pages[index], collected, young_count, old_count, statistics);
+		}
+		std::unique_lock<std::mutex> lock(mutex);
+		merge_statistics(m_statistics, statistics);
+		m_collected.insert(m_collected.end(), collected.begin(), collected.end());
+		m_young_count -= young_count;
+		m_old_count -= old_count;
+	});
+
+	m_sweep_page = pages.size();
+}
+
+void GarbageCollector::mark(Data *data) {
+	// data marked by a collector thread are traced by the same thread
+	if (MarkWorker *worker = g_mark_worker) {
+		worker->shade(data);
+	}
+	else {
+		shade(data);
+	}
+}
+
+void GarbageCollector::shade_pending() {
+	for (Data *&data : m_pending) {
+		if (data) {
+			shade(data);
+			data = nullptr;
+		}
+	}
+}
+
+template<class Marker>
+void GarbageCollector::trace(Marker &marker, Data *data) {
+
+	using Tracer = void (*)(Marker &, Data *);
+
+	static constexpr const Tracer trace_object = [](Marker &marker, Data *data) {
+		auto *object = static_cast<Object *>(data);
+		if (object->data) {
+			for (size_t offset = 0; offset < object->metadata->size(); ++offset) {
+				marker.shade_later(object->data[offset].data());
+			}
+		}
+	};
+
+	static constexpr const std::array<Tracer, Class::BUILTIN_CLASS_COUNT> g_object_tracers = {
+		/* OBJECT */ trace_object,
+		/* STRING */ trace_object,
+		/* REGEX */ trace_object,
+		/* ARRAY */
+		[](Marker &marker, Data *data) {
+			trace_object(marker, data);
+			for (const WeakReference &item : static_cast<Array *>(data)->values) {
+				marker.shade_later(item.data());
+			}
+		},
+		/* HASH */
+		[](Marker &marker, Data *data) {
+			trace_object(marker, data);
+			for (const auto &[key, value] : static_cast<Hash *>(data)->values) {
+				marker.shade_later(key.data());
+				marker.shade_later(value.data());
+			}
+		},
+		/* ITERATOR */
+		[](Marker &marker, Data *data) {
+			trace_object(marker, data);
+			static_cast<Iterator *>(data)->ctx.mark();
+		},
+		/* LIBRARY */ trace_object,
+		/* LIBOBJECT */ trace_object,
+	};
+
+	static constexpr const std::array<Tracer, Data::FMT_FUNCTION + 1> g_tracers = {
+		/* FMT_NONE */ nullptr,
+		/* FMT_NULL */ nullptr,
+		/* FMT_NUMBER */ nullptr,
+		/* FMT_BOOLEAN */ nullptr,
+		/* FMT_OBJECT */
+		[](Marker &marker, Data *data) {
+			g_object_tracers[static_cast<Object *>(data)->metadata->metatype()](marker, data);
+		},
+		/* FMT_PACKAGE */ nullptr,
+		/* FMT_FUNCTION */
+		[](Marker &marker, Data *data) {
+			for (const auto &signature : static_cast<Function *>(data)->mapping) {
+				if (const auto &capture = signature.second.capture) {
+					for (const auto &reference : *capture) {
+						marker.shade_later(reference.second.data());
+					}
+				}
+			}
+		},
+	};
+
+	if (const Tracer tracer = g_tracers[data->format]) {
+		tracer(marker, data);
+	}
+}
+
+template<class Filter>
+std::unordered_map<Data *, size_t> GarbageCollector::count_internal_references(const std::vector<HeapPage *> &pages,
+																			   HeapPage::Bitmap HeapPage::*holders,
+																			   Filter filter) {
+
+	// count the holders of each reference info to a data accepted by filter
+	std::unordered_map<Reference::Info *, size_t> counts;
+	for (HeapPage *page : pages) {
+		page->for_each(page->*holders, [&counts, &filter](void *address) {
+			visit_references(static_cast<Data *>(address), [&counts, &filter](const Reference &reference) {
+				if (filter(reference.m_info->data)) {
+					++counts[reference.m_info];
+				}
+			});
+		});
+	}
+
+	// an info that is only held by the visited data is an internal reference
+	std::unordered_map<Data *, size_t> internal_references;
+	for (const auto &[info, count] : counts) {
+		if (count == info->refcount) {
+			++internal_references[info->data];
+		}
+	}
+
+	return internal_references;
+}
+
+size_t GarbageCollector::finish_cycle() {
+
+	assert(m_phase == SWEEPING);
+	assert(m_sweep_page == m_heap.pages().size());
+
+	promote_young_generation();
+	m_next_major_collection = next_major_collection();
+	m_phase = IDLE;
+	++m_statistics.full_collections;
+
+	// garbage can refer to other garbage, the whole cycle is released at once
+	std::vector<Data *> collected = std::move(m_collected);
+	m_collected.clear();
+	dispose(collected);
+
+	// the destructors can have started a new cycle using the current pages
+	if (m_phase == IDLE) {
+		reclaim_memory();
 	}
 
+	return collected.size();
+}
+
+size_t GarbageCollector::next_major_collection() const {
+
+	if (m_collection_threshold == 0) {
+		return std::numeric_limits<size_t>::max();
+	}
+
+	// the old generation can grow by a ratio of the data that survived the last
+	// full collection
+	const auto grown = static_cast<size_t>(static_cast<double>(m_old_count) * m_collection_growth);
+	return std::max(m_collection_threshold, grown);
+}
+
+void GarbageCollector::promote_young_generation() {
+
+	for (HeapPage *page : m_young_pages) {
+		page->young.clear();
+		page->in_young_pages = false;
+	}
+	m_young_pages.clear();
+
+	m_old_count += m_young_count;
+	m_young_count = 0;
+}
+
+void GarbageCollector::reclaim_memory() {
+	// the memory stays allocated for a few collections to be reused by the
+	// next allocations instead of being given back and requested again
+	m_statistics.reclaimed_bytes += m_heap.reclaim(m_reclaim_delay);
+	m_statistics.reclaimed_bytes += Reference::g_pool.reclaim(m_reclaim_delay);
+}
+
+void GarbageCollector::dispose(const std::vector<Data *> &collected) {
+
 	// call destructors as possible
 	if (Scheduler *scheduler = Scheduler::instance()) {
 		for (Data *data : collected) {
@@ -134,28 +1152,66 @@ size_t GarbageCollector::collect() {
 	for (Data *data : collected) {
 		GarbageCollector::destroy(data);
 	}
-
-	return collected.size();
 }
 
-void GarbageCollector::clean() {
-
-	assert(m_stacks.empty());
-	assert(m_roots.head == nullptr);
+void GarbageCollector::record_pause(std::chrono::steady_clock::time_point start) {
+	const auto pause = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+	++m_statistics.pauses;
+	m_statistics.pause_time += pause;
+	m_statistics.max_pause_time = std::max(m_statistics.max_pause_time, pause);
+	m_statistics.last_pause_time = pause;
+}
 
-	while (collect() > 0) {
-		;
+void GarbageCollector::sample_allocation(Data *data, size_t size) {
+	if (m_heap_profiler) {
+		m_heap_profiler->sample(data, size);
+		data->infos.sampled = true;
+		m_bytes_until_sample = m_heap_profiler->next_sample();
+	}
+	else {
+		m_bytes_until_sample = std::numeric_limits<size_t>::max();
 	}
+}
 
-	assert(m_memory.head == nullptr);
+void GarbageCollector::dump_heap_profile() {
+	if (m_heap_profiler && !m_heap_profile_path.empty()) {
+		m_heap_profiler->dump(m_heap_profile_path + ".live.folded", HeapProfiler::LIVE_BYTES);
+		m_heap_profiler->dump(m_heap_profile_path + ".alloc.folded", HeapProfiler::ALLOCATED_BYTES);
+	}
 }
 
 void GarbageCollector::register_data(Data *data) {
-	GC_LIST_INSERT_ELEMENT(m_memory, data);
+	HeapPage *page = HeapPage::of(data);
+	const size_t granule = HeapPage::granule(data);
+	page->allocated.set(granule);
+	page->young.set(granule);
+	if (!page->in_young_pages) {
+		page->in_young_pages = true;
+		m_young_pages.emplace_back(page);
+	}
+	// data allocated during a cycle are kept until the next one
+	if (m_phase != IDLE) {
+		page->marked.set(granule);
+	}
+	++m_young_count;
 }
 
 void GarbageCollector::unregister_data(Data *data) {
-	GC_LIST_REMOVE_ELEMENT(m_memory, data);
+	if (data->infos.grey) {
+		m_grey[data->infos.grey - 1] = nullptr;
+		data->infos.grey = 0;
+	}
+	HeapPage *page = HeapPage::of(data);
+	const size_t granule = HeapPage::granule(data);
+	page->allocated.reset(granule);
+	page->marked.reset(granule);
+	if (page->young.test(granule)) {
+		page->young.reset(granule);
+		--m_young_count;
+	}
+	else {
+		--m_old_count;
+	}
 }
 
 void GarbageCollector::register_root(MemoryRoot *reference) {
@@ -249,10 +1305,31 @@ Data *GarbageCollector::copy(const Data *other) {
 }
 
 void GarbageCollector::free(Data *ptr) {
+
+	// the data released by the destruction of ptr are freed once ptr is freed,
+	// so freeing a deep structure does not use a deep native stack
+	if (m_releasing) {
+		m_released.emplace_back(ptr);
+		return;
+	}
+
+	m_releasing = true;
+	free_data(ptr);
+	while (!m_released.empty()) {
+		Data *data = m_released.back();
+		m_released.pop_back();
+		free_data(data);
+	}
+	m_releasing = false;
+}
+
+void GarbageCollector::free_data(Data *ptr) {
+	forget_allocation(ptr);
 	switch (ptr->format) {
 	case Data::FMT_NONE:
 	case Data::FMT_NULL:
-		delete ptr;
+		ptr->~Data();
+		m_heap.deallocate(ptr);
 		break;
 	case Data::FMT_NUMBER:
 		Number::g_pool.free(static_cast<Number *>(ptr));
@@ -288,10 +1365,16 @@ void GarbageCollector::free(Data *ptr) {
 }
 
 void GarbageCollector::destroy(Data *ptr) {
+	forget_allocation(ptr);
+	if (UNLIKELY(ptr->infos.refcount)) {
+		destroy_referenced(ptr);
+		return;
+	}
 	switch (ptr->format) {
 	case Data::FMT_NONE:
 	case Data::FMT_NULL:
-		delete ptr;
+		ptr->~Data();
+		m_heap.deallocate(ptr);
 		break;
 	case Data::FMT_NUMBER:
 		Number::g_pool.free(static_cast<Number *>(ptr));
@@ -312,6 +1395,16 @@ void GarbageCollector::destroy(Data *ptr) {
 }
 
 void GarbageCollector::destroy(Object *ptr) {
+	forget_allocation(ptr);
+	// the object can be shaded again by its destructor once it was unregistered
+	if (ptr->infos.grey) {
+		m_grey[ptr->infos.grey - 1] = nullptr;
+		ptr->infos.grey = 0;
+	}
+	if (UNLIKELY(ptr->infos.refcount)) {
+		destroy_referenced(ptr);
+		return;
+	}
 	switch (ptr->metadata->metatype()) {
 	case Class::OBJECT:
 		Object::g_pool.free(ptr);
@@ -335,11 +1428,26 @@ void GarbageCollector::destroy(Object *ptr) {
 		Library::g_pool.free(static_cast<Library *>(ptr));
 		break;
 	case Class::LIBOBJECT:
-		delete ptr;
+		// the type of the library object is unknown, the virtual destructor is used
+		static_cast<Data *>(ptr)->~Data();
+		m_heap.deallocate(ptr);
 		break;
 	}
 }
 
+void GarbageCollector::destroy_referenced(Data *ptr) {
+	// a collection does not see the native references, the data can still be
+	// referenced once collected; its content is destroyed but its slot is kept
+	// until the last reference is released, so the heap page is not reclaimed
+	ptr->~Data();
+	if (ptr->infos.refcount) {
+		ptr->infos.destroyed = true;
+	}
+	else {
+		m_heap.deallocate(ptr);
+	}
+}
+
 MemoryRoot::MemoryRoot() {
 	g_garbage_collector.register_root(this);
 }
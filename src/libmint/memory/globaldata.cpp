@@ -146,6 +146,7 @@ GlobalData::GlobalData() :
 
 GlobalData::~GlobalData() {
 	std::for_each(m_builtin.begin(), m_builtin.end(), std::default_delete<Class>());
+	std::for_each(m_booleans.begin(), m_booleans.end(), std::default_delete<StrongReference>());
 	delete m_none;
 	delete m_null;
 	g_instance = nullptr;
@@ -167,4 +168,7 @@ void GlobalData::cleanup_builtin() {
 
 	delete m_null;
 	m_null = nullptr;
+
+	std::for_each(m_booleans.begin(), m_booleans.end(), std::default_delete<StrongReference>());
+	m_booleans.fill(nullptr);
 }
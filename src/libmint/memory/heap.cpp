@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2025 Gauvain CHERY.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "mint/memory/heap.h"
+#include "mint/system/assert.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#ifdef OS_WINDOWS
+#include <malloc.h>
+#endif
+
+using namespace mint;
+
+namespace {
+
+void *allocate_page() {
+#ifdef OS_WINDOWS
+	return _aligned_malloc(HeapPage::SIZE, HeapPage::SIZE);
+#else
+	return std::aligned_alloc(HeapPage::SIZE, HeapPage::SIZE);
+#endif
+}
+
+void free_page(void *address) {
+#ifdef OS_WINDOWS
+	_aligned_free(address);
+#else
+	std::free(address);
+#endif
+}
+
+}
+
+HeapPage::HeapPage(size_t slot_size) :
+	slot_size(slot_size) {
+	// the slots start at the first granule after the header
+	const size_t header_size = ((sizeof(HeapPage) - 1) / GRANULE_SIZE + 1) * GRANULE_SIZE;
+	m_unused = reinterpret_cast<byte_t *>(this) + header_size;
+}
+
+Heap::~Heap() {
+	for (HeapPage *page : m_pages) {
+		page->~HeapPage();
+		free_page(page);
+	}
+}
+
+Heap &Heap::instance() {
+
+	static Heap g_instance;
+	return g_instance;
+}
+
+size_t Heap::reclaim(size_t delay) {
+
+	size_t reclaimed = 0;
+	auto last = std::remove_if(m_pages.begin(), m_pages.end(), [&reclaimed, delay](HeapPage *page) {
+		// the collector can still refer to an empty page of the young generation
+		if (page->used || page->in_young_pages) {
+			page->idle_collections = 0;
+			return false;
+		}
+		if (++page->idle_collections <= delay) {
+			return false;
+		}
+		page->~HeapPage();
+		free_page(page);
+		reclaimed += HeapPage::SIZE;
+		return true;
+	});
+
+	if (last == m_pages.end()) {
+		return 0;
+	}
+
+	m_pages.erase(last, m_pages.end());
+
+	// the released pages can be part of the available lists
+	m_available.fill(nullptr);
+	for (HeapPage *page : m_pages) {
+		if (page->is_full()) {
+			page->next_available = nullptr;
+			page->available = false;
+		}
+		else {
+			const size_t size_class = page->slot_size / HeapPage::GRANULE_SIZE - 1;
+			page->next_available = m_available[size_class];
+			page->available = true;
+			m_available[size_class] = page;
+		}
+	}
+
+	return reclaimed;
+}
+
+HeapPage *Heap::create_page(size_t slot_size) {
+	void *address = assert_not_null<std::bad_alloc>(allocate_page());
+	auto *page = new (address) HeapPage(slot_size);
+	m_pages.emplace_back(page);
+	return page;
+}
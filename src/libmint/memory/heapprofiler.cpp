@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2025 Gauvain CHERY.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "mint/memory/heapprofiler.h"
+#include "mint/scheduler/scheduler.h"
+#include "mint/system/assert.h"
+#include "mint/system/filesystem.h"
+
+#include <cmath>
+
+using namespace mint;
+
+namespace {
+
+/*
+ * Returns the calls of the current process in the folded stack format, from
+ * the outermost call to the allocating line.
+ */
+std::string current_stack() {
+
+	Scheduler *scheduler = Scheduler::instance();
+	if (scheduler == nullptr) {
+		return "[native]";
+	}
+
+	Process *process = scheduler->current_process();
+	if (process == nullptr) {
+		return "[native]";
+	}
+
+	std::string stack;
+	const LineInfoList infos = process->cursor()->dump();
+	for (auto info = infos.rbegin(); info != infos.rend(); ++info) {
+		if (!stack.empty()) {
+			stack += ';';
+		}
+		stack += info->module_name() + ':' + std::to_string(info->line_number());
+	}
+
+	return stack.empty() ? "[native]" : stack;
+}
+
+}
+
+HeapProfiler::HeapProfiler(size_t sampling_interval) :
+	m_sampling_interval(sampling_interval),
+	m_distribution(1. / static_cast<double>(sampling_interval)) {
+	assert(sampling_interval > 0);
+}
+
+size_t HeapProfiler::sampling_interval() const {
+	return m_sampling_interval;
+}
+
+size_t HeapProfiler::next_sample() {
+	// the distance between two samples is random, so a periodic allocation
+	// pattern can not always miss the same data
+	return static_cast<size_t>(m_distribution(m_generator)) + 1;
+}
+
+void HeapProfiler::sample(const Data *data, size_t size) {
+
+	std::string stack = current_stack();
+	auto i = m_site_indexes.find(stack);
+	if (i == m_site_indexes.end()) {
+		i = m_site_indexes.emplace(stack, m_sites.size()).first;
+		m_sites.push_back(Site {std::move(stack)});
+	}
+
+	// each sample stands for the allocations of the same size that were not sampled
+	const double probability = 1. - std::exp(-static_cast<double>(size) / static_cast<double>(m_sampling_interval));
+	const double objects = 1. / probability;
+	const double bytes = objects * static_cast<double>(size);
+
+	Site &site = m_sites[i->second];
+	site.allocated_objects += objects;
+	site.allocated_bytes += bytes;
+	site.live_objects += objects;
+	site.live_bytes += bytes;
+
+	m_samples[data] = {i->second, objects, bytes};
+}
+
+void HeapProfiler::release(const Data *data) {
+
+	auto i = m_samples.find(data);
+	if (i == m_samples.end()) {
+		return;
+	}
+
+	Site &site = m_sites[i->second.site];
+	site.live_objects -= i->second.objects;
+	site.live_bytes -= i->second.bytes;
+	m_samples.erase(i);
+}
+
+void HeapProfiler::write(FILE *stream, Profile profile) const {
+	for (const Site &site : m_sites) {
+		double value = 0;
+		switch (profile) {
+		case LIVE_OBJECTS:
+			value = site.live_objects;
+			break;
+		case LIVE_BYTES:
+			value = site.live_bytes;
+			break;
+		case ALLOCATED_OBJECTS:
+			value = site.allocated_objects;
+			break;
+		case ALLOCATED_BYTES:
+			value = site.allocated_bytes;
+			break;
+		}
+		if (const long long count = std::llround(value); count > 0) {
+			fprintf(stream, "%s %lld\n", site.stack.c_str(), count);
+		}
+	}
+}
+
+bool HeapProfiler::dump(const std::filesystem::path &path, Profile profile) const {
+
+	FILE *stream = open_file(path, "w");
+	if (stream == nullptr) {
+		return false;
+	}
+
+	write(stream, profile);
+	return fclose(stream) == 0;
+}
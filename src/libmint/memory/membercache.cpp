@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2025 Gauvain CHERY.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "mint/memory/membercache.h"
+#include "mint/memory/symboltable.h"
+#include "mint/memory/object.h"
+#include "mint/ast/cursor.h"
+
+using namespace mint;
+
+std::atomic_size_t MemberCache::g_generation = 0;
+
+void MemberCache::invalidate_all() {
+	g_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+Class::MemberInfo *MemberCache::find(const Cursor *cursor, Object *object) {
+
+	if (const size_t generation = g_generation.load(std::memory_order_relaxed); UNLIKELY(m_generation != generation)) {
+		m_generation = generation;
+		m_size = 0;
+		return nullptr;
+	}
+
+	for (size_t i = 0; i < m_size && i < ENTRY_COUNT; ++i) {
+		const Entry &entry = m_entries[i];
+		if (entry.metadata == object->metadata) {
+			const auto visibility = static_cast<Reference::Flags>(Class::MemberInfo::get(entry.info, object).flags()
+																  & Reference::VISIBILITY_MASK);
+			if (!visibility) {
+				return entry.info;
+			}
+			if (visibility == entry.visibility && !cursor->is_in_builtin()
+				&& entry.context == cursor->symbols().get_metadata()
+				&& entry.package == cursor->symbols().get_package()) {
+				return entry.info;
+			}
+			return nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
+void MemberCache::insert(const Cursor *cursor, Object *object, Class::MemberInfo *info) {
+
+	if (const size_t generation = g_generation.load(std::memory_order_relaxed); UNLIKELY(m_generation != generation)) {
+		m_generation = generation;
+		m_size = 0;
+	}
+
+	const Entry entry = {
+		object->metadata,
+		info,
+		static_cast<Reference::Flags>(Class::MemberInfo::get(info, object).flags() & Reference::VISIBILITY_MASK),
+		cursor->symbols().get_metadata(),
+		cursor->symbols().get_package(),
+	};
+
+	for (size_t i = 0; i < m_size && i < ENTRY_COUNT; ++i) {
+		if (m_entries[i].metadata == entry.metadata) {
+			m_entries[i] = entry;
+			return;
+		}
+	}
+
+	if (m_size < ENTRY_COUNT) {
+		m_entries[m_size] = entry;
+	}
+
+	if (m_size <= ENTRY_COUNT) {
+		++m_size;
+	}
+}
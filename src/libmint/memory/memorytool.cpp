@@ -22,6 +22,7 @@
  */
 
 #include "mint/memory/memorytool.h"
+#include "mint/memory/membercache.h"
 #include "mint/memory/globaldata.h"
 #include "mint/memory/objectprinter.h"
 #include "mint/memory/casttool.h"
@@ -115,6 +116,54 @@ Cursor::Call &setup_member_call(Cursor *cursor, Reference &reference) {
 	return call;
 }
 
+Reference &get_object_member(Cursor *cursor, Object *object, const Symbol &member, Class::MemberInfo *info) {
+
+	Reference &result = Class::MemberInfo::get(info, object);
+
+	switch (result.flags() & Reference::VISIBILITY_MASK) {
+	case Reference::PROTECTED_VISIBILITY:
+		if (UNLIKELY(!is_protected_accessible(cursor, info->owner))) {
+			error("could not access protected member '%s' of class '%s'", member.str().c_str(),
+				  object->metadata->full_name().c_str());
+		}
+		break;
+	case Reference::PRIVATE_VISIBILITY:
+		if (UNLIKELY(!is_private_accessible(cursor, info->owner))) {
+			error("could not access private member '%s' of class '%s'", member.str().c_str(),
+				  object->metadata->full_name().c_str());
+		}
+		break;
+	case Reference::PACKAGE_VISIBILITY:
+		if (UNLIKELY(!is_package_accessible(cursor, info->owner))) {
+			error("could not access package member '%s' of class '%s'", member.str().c_str(),
+				  object->metadata->full_name().c_str());
+		}
+		break;
+	default:
+		break;
+	}
+
+	return result;
+}
+
+void setup_member_function(Cursor *cursor, WeakReference &&function, Class *owner) {
+
+	if (function.flags() & Reference::GLOBAL) {
+		cursor->stack().pop_back();
+	}
+
+	if (function.data()->format != Data::FMT_OBJECT) {
+		cursor->waiting_calls().emplace(std::forward<Reference>(function));
+		cursor->waiting_calls().top().set_metadata(owner);
+	}
+	else if (setup_member_call(cursor, function).get_flags() & Cursor::Call::OPERATOR_CALL) {
+		cursor->stack().back() = std::forward<Reference>(function);
+	}
+	else {
+		cursor->stack().emplace_back(std::forward<Reference>(function));
+	}
+}
+
 }
 
 std::string mint::type_name(const Reference &reference) {
@@ -256,24 +305,15 @@ void mint::init_call(Cursor *cursor, Reference &function) {
 }
 
 void mint::init_member_call(Cursor *cursor, const Symbol &member) {
-
 	Class *owner = nullptr;
 	WeakReference function = get_member(cursor, cursor->stack().back(), member, &owner);
+	setup_member_function(cursor, std::move(function), owner);
+}
 
-	if (function.flags() & Reference::GLOBAL) {
-		cursor->stack().pop_back();
-	}
-
-	if (function.data()->format != Data::FMT_OBJECT) {
-		cursor->waiting_calls().emplace(std::forward<Reference>(function));
-		cursor->waiting_calls().top().set_metadata(owner);
-	}
-	else if (setup_member_call(cursor, function).get_flags() & Cursor::Call::OPERATOR_CALL) {
-		cursor->stack().back() = std::forward<Reference>(function);
-	}
-	else {
-		cursor->stack().emplace_back(std::forward<Reference>(function));
-	}
+void mint::init_member_call(Cursor *cursor, const Symbol &member, MemberCache *cache) {
+	Class *owner = nullptr;
+	WeakReference function = get_member(cursor, cursor->stack().back(), member, cache, &owner);
+	setup_member_function(cursor, std::move(function), owner);
 }
 
 void mint::init_operator_call(Cursor *cursor, Class::Operator op) {
@@ -337,15 +377,9 @@ void mint::init_parameter(Cursor *cursor, const Symbol &symbol, mint::Reference:
 
 Function::Mapping::iterator mint::find_function_signature(Cursor *cursor, Function::Mapping &mapping, int signature) {
 
-	auto it = mapping.find(signature);
-
-	if (it != mapping.end()) {
-		return it;
-	}
-
-	it = mapping.lower_bound(~signature);
+	auto it = mapping.resolve(signature);
 
-	if (it != mapping.end()) {
+	if (it != mapping.end() && it->first != signature) {
 
 		auto &stack = cursor->stack();
 		const int required = ~it->first;
@@ -459,30 +493,7 @@ WeakReference mint::get_member(Cursor *cursor, const Reference &reference, const
 			if (auto it = object->metadata->members().find(member); it != object->metadata->members().end()) {
 				if (is_object(object)) {
 
-					Reference &result = Class::MemberInfo::get(it->second, object);
-
-					switch (result.flags() & Reference::VISIBILITY_MASK) {
-					case Reference::PROTECTED_VISIBILITY:
-						if (UNLIKELY(!is_protected_accessible(cursor, it->second->owner))) {
-							error("could not access protected member '%s' of class '%s'", member.str().c_str(),
-								  object->metadata->full_name().c_str());
-						}
-						break;
-					case Reference::PRIVATE_VISIBILITY:
-						if (UNLIKELY(!is_private_accessible(cursor, it->second->owner))) {
-							error("could not access private member '%s' of class '%s'", member.str().c_str(),
-								  object->metadata->full_name().c_str());
-						}
-						break;
-					case Reference::PACKAGE_VISIBILITY:
-						if (UNLIKELY(!is_package_accessible(cursor, it->second->owner))) {
-							error("could not access package member '%s' of class '%s'", member.str().c_str(),
-								  object->metadata->full_name().c_str());
-						}
-						break;
-					default:
-						break;
-					}
+					Reference &result = get_object_member(cursor, object, member, it->second);
 
 					if (owner) {
 						*owner = it->second->owner;
@@ -613,6 +624,39 @@ WeakReference mint::get_member(Cursor *cursor, const Reference &reference, const
 	return {};
 }
 
+WeakReference mint::get_member(Cursor *cursor, const Reference &reference, const Symbol &member, MemberCache *cache,
+								Class **owner) {
+
+	if (reference.data()->format == Data::FMT_OBJECT && !cache->is_megamorphic()) {
+		Object *object = reference.data<Object>();
+		if (object && is_object(object)) {
+
+			if (Class::MemberInfo *info = cache->find(cursor, object)) {
+
+				if (owner) {
+					*owner = info->owner;
+				}
+
+				return WeakReference::share(Class::MemberInfo::get(info, object));
+			}
+
+			if (auto it = object->metadata->members().find(member); it != object->metadata->members().end()) {
+
+				Reference &result = get_object_member(cursor, object, member, it->second);
+				cache->insert(cursor, object, it->second);
+
+				if (owner) {
+					*owner = it->second->owner;
+				}
+
+				return WeakReference::share(result);
+			}
+		}
+	}
+
+	return get_member(cursor, reference, member, owner);
+}
+
 WeakReference mint::get_operator(Cursor *cursor, const Reference &reference, Class::Operator op, Class **owner) {
 
 	switch (reference.data()->format) {
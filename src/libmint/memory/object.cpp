@@ -164,17 +164,6 @@ void Object::construct(const Object &other, std::unordered_map<const Data *, Dat
 	}
 }
 
-void Object::mark() {
-	if (!marked_bit()) {
-		Data::mark();
-		if (data) {
-			for (size_t offset = 0; offset < metadata->size(); ++offset) {
-				data[offset].data()->mark();
-			}
-		}
-	}
-}
-
 Package::Package(PackageData *package) :
 	Data(FMT_PACKAGE),
 	data(package) {}
@@ -294,6 +283,7 @@ std::pair<Function::Mapping::iterator, bool> Function::Mapping::emplace(int sign
 	if (handle.capture) {
 		m_data->sharable = false;
 	}
+	m_data->resolved_mask = 0;
 	return m_data->signatures.emplace(signature, handle);
 }
 
@@ -304,6 +294,7 @@ std::pair<Function::Mapping::iterator, bool> Function::Mapping::insert(const std
 	if (signature.second.capture) {
 		m_data->sharable = false;
 	}
+	m_data->resolved_mask = 0;
 	return m_data->signatures.insert(signature);
 }
 
@@ -315,6 +306,27 @@ Function::Mapping::iterator Function::Mapping::find(int signature) const {
 	return m_data->signatures.find(signature);
 }
 
+Function::Mapping::iterator Function::Mapping::resolve(int signature) const {
+
+	const auto lookup = [this](int signature) {
+		if (auto it = m_data->signatures.find(signature); it != m_data->signatures.end()) {
+			return it;
+		}
+		return m_data->signatures.lower_bound(~signature);
+	};
+
+	if (signature >= 0 && signature < FLAT_SIGNATURE_COUNT) {
+		const std::uint32_t flag = 1u << signature;
+		if (!(m_data->resolved_mask & flag)) {
+			m_data->resolved[static_cast<size_t>(signature)] = lookup(signature);
+			m_data->resolved_mask |= flag;
+		}
+		return m_data->resolved[static_cast<size_t>(signature)];
+	}
+
+	return lookup(signature);
+}
+
 Function::Mapping::const_iterator Function::Mapping::cbegin() const {
 	return m_data->signatures.cbegin();
 }
@@ -343,15 +355,3 @@ bool Function::Mapping::empty() const {
 	return m_data->signatures.empty();
 }
 
-void Function::mark() {
-	if (!marked_bit()) {
-		Data::mark();
-		for (const auto &signature : mapping) {
-			if (const auto &capture = signature.second.capture) {
-				for (const auto &reference : *capture) {
-					reference.second.data()->mark();
-				}
-			}
-		}
-	}
-}
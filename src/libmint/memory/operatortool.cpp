@@ -352,6 +352,11 @@ void mint::add_operator(Cursor *cursor) {
 			lvalue.data<Number>()->value += to_number(cursor, rvalue);
 			cursor->stack().pop_back();
 		}
+		else if ((rvalue.flags() & Reference::TEMPORARY) && rvalue.data()->format == Data::FMT_NUMBER) {
+			rvalue.data<Number>()->value = lvalue.data<Number>()->value + rvalue.data<Number>()->value;
+			lvalue = std::move(rvalue);
+			cursor->stack().pop_back();
+		}
 		else {
 			Reference &&result = WeakReference::create<Number>(lvalue.data<Number>()->value + to_number(cursor, rvalue));
 			cursor->stack().pop_back();
@@ -414,6 +419,11 @@ void mint::sub_operator(Cursor *cursor) {
 			lvalue.data<Number>()->value -= to_number(cursor, rvalue);
 			cursor->stack().pop_back();
 		}
+		else if ((rvalue.flags() & Reference::TEMPORARY) && rvalue.data()->format == Data::FMT_NUMBER) {
+			rvalue.data<Number>()->value = lvalue.data<Number>()->value - rvalue.data<Number>()->value;
+			lvalue = std::move(rvalue);
+			cursor->stack().pop_back();
+		}
 		else {
 			Reference &&result = WeakReference::create<Number>(lvalue.data<Number>()->value - to_number(cursor, rvalue));
 			cursor->stack().pop_back();
@@ -461,6 +471,11 @@ void mint::mul_operator(Cursor *cursor) {
 			lvalue.data<Number>()->value *= to_number(cursor, rvalue);
 			cursor->stack().pop_back();
 		}
+		else if ((rvalue.flags() & Reference::TEMPORARY) && rvalue.data()->format == Data::FMT_NUMBER) {
+			rvalue.data<Number>()->value = lvalue.data<Number>()->value * rvalue.data<Number>()->value;
+			lvalue = std::move(rvalue);
+			cursor->stack().pop_back();
+		}
 		else {
 			Reference &&result = WeakReference::create<Number>(lvalue.data<Number>()->value * to_number(cursor, rvalue));
 			cursor->stack().pop_back();
@@ -625,7 +640,7 @@ void mint::is_operator(Cursor *cursor) {
 	const Reference &rvalue = load_from_stack(cursor, base);
 	const Reference &lvalue = load_from_stack(cursor, base - 1);
 
-	WeakReference result = WeakReference::create<Boolean>(lvalue.data() == rvalue.data());
+	WeakReference result = share_boolean(lvalue.data() == rvalue.data());
 	cursor->stack().pop_back();
 	cursor->stack().back() = std::move(result);
 }
@@ -640,14 +655,14 @@ void mint::eq_operator(Cursor *cursor) {
 	switch (lvalue.data()->format) {
 	case Data::FMT_NONE:
 		{
-			Reference &&result = WeakReference::create<Boolean>(rvalue.data()->format == Data::FMT_NONE);
+			Reference &&result = share_boolean(rvalue.data()->format == Data::FMT_NONE);
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
 		break;
 	case Data::FMT_NULL:
 		{
-			Reference &&result = WeakReference::create<Boolean>(rvalue.data()->format == Data::FMT_NULL);
+			Reference &&result = share_boolean(rvalue.data()->format == Data::FMT_NULL);
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -657,14 +672,13 @@ void mint::eq_operator(Cursor *cursor) {
 		case Data::FMT_NONE:
 		case Data::FMT_NULL:
 			{
-				Reference &&result = WeakReference::create<Boolean>(false);
+				Reference &&result = share_boolean(false);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
 			break;
 		default:
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Number>()->value
-																== to_number(cursor, rvalue));
+			Reference &&result = share_boolean(lvalue.data<Number>()->value == to_number(cursor, rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -674,13 +688,13 @@ void mint::eq_operator(Cursor *cursor) {
 		case Data::FMT_NONE:
 		case Data::FMT_NULL:
 			{
-				Reference &&result = WeakReference::create<Boolean>(false);
+				Reference &&result = share_boolean(false);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
 			break;
 		default:
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Boolean>()->value == to_boolean(rvalue));
+			Reference &&result = share_boolean(lvalue.data<Boolean>()->value == to_boolean(rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -691,7 +705,7 @@ void mint::eq_operator(Cursor *cursor) {
 			case Data::FMT_NONE:
 			case Data::FMT_NULL:
 				{
-					Reference &&result = WeakReference::create<Boolean>(false);
+					Reference &&result = share_boolean(false);
 					cursor->stack().pop_back();
 					cursor->stack().back() = std::move(result);
 				}
@@ -705,8 +719,7 @@ void mint::eq_operator(Cursor *cursor) {
 		error("invalid use of package in an operation");
 	case Data::FMT_FUNCTION:
 		if (rvalue.data()->format == Data::FMT_FUNCTION) {
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Function>()->mapping
-																== rvalue.data<Function>()->mapping);
+			Reference &&result = share_boolean(lvalue.data<Function>()->mapping == rvalue.data<Function>()->mapping);
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -726,14 +739,14 @@ void mint::ne_operator(Cursor *cursor) {
 	switch (lvalue.data()->format) {
 	case Data::FMT_NONE:
 		{
-			Reference &&result = WeakReference::create<Boolean>(rvalue.data()->format != Data::FMT_NONE);
+			Reference &&result = share_boolean(rvalue.data()->format != Data::FMT_NONE);
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
 		break;
 	case Data::FMT_NULL:
 		{
-			Reference &&result = WeakReference::create<Boolean>(rvalue.data()->format != Data::FMT_NULL);
+			Reference &&result = share_boolean(rvalue.data()->format != Data::FMT_NULL);
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -743,14 +756,13 @@ void mint::ne_operator(Cursor *cursor) {
 		case Data::FMT_NONE:
 		case Data::FMT_NULL:
 			{
-				Reference &&result = WeakReference::create<Boolean>(true);
+				Reference &&result = share_boolean(true);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
 			break;
 		default:
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Number>()->value
-																!= to_number(cursor, rvalue));
+			Reference &&result = share_boolean(lvalue.data<Number>()->value != to_number(cursor, rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -760,13 +772,13 @@ void mint::ne_operator(Cursor *cursor) {
 		case Data::FMT_NONE:
 		case Data::FMT_NULL:
 			{
-				Reference &&result = WeakReference::create<Boolean>(true);
+				Reference &&result = share_boolean(true);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
 			break;
 		default:
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Boolean>()->value != to_boolean(rvalue));
+			Reference &&result = share_boolean(lvalue.data<Boolean>()->value != to_boolean(rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -777,7 +789,7 @@ void mint::ne_operator(Cursor *cursor) {
 			case Data::FMT_NONE:
 			case Data::FMT_NULL:
 				{
-					Reference &&result = WeakReference::create<Boolean>(true);
+					Reference &&result = share_boolean(true);
 					cursor->stack().pop_back();
 					cursor->stack().back() = std::move(result);
 				}
@@ -791,8 +803,7 @@ void mint::ne_operator(Cursor *cursor) {
 		error("invalid use of package in an operation");
 	case Data::FMT_FUNCTION:
 		if (rvalue.data()->format == Data::FMT_FUNCTION) {
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Function>()->mapping
-																!= rvalue.data<Function>()->mapping);
+			Reference &&result = share_boolean(lvalue.data<Function>()->mapping != rvalue.data<Function>()->mapping);
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -817,15 +828,14 @@ void mint::lt_operator(Cursor *cursor) {
 		break;
 	case Data::FMT_NUMBER:
 		{
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Number>()->value
-																< to_number(cursor, rvalue));
+			Reference &&result = share_boolean(lvalue.data<Number>()->value < to_number(cursor, rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
 		break;
 	case Data::FMT_BOOLEAN:
 		{
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Boolean>()->value < to_boolean(rvalue));
+			Reference &&result = share_boolean(lvalue.data<Boolean>()->value < to_boolean(rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -857,15 +867,14 @@ void mint::gt_operator(Cursor *cursor) {
 		break;
 	case Data::FMT_NUMBER:
 		{
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Number>()->value
-																> to_number(cursor, rvalue));
+			Reference &&result = share_boolean(lvalue.data<Number>()->value > to_number(cursor, rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
 		break;
 	case Data::FMT_BOOLEAN:
 		{
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Boolean>()->value > to_boolean(rvalue));
+			Reference &&result = share_boolean(lvalue.data<Boolean>()->value > to_boolean(rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -897,15 +906,14 @@ void mint::le_operator(Cursor *cursor) {
 		break;
 	case Data::FMT_NUMBER:
 		{
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Number>()->value
-																<= to_number(cursor, rvalue));
+			Reference &&result = share_boolean(lvalue.data<Number>()->value <= to_number(cursor, rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
 		break;
 	case Data::FMT_BOOLEAN:
 		{
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Boolean>()->value <= to_boolean(rvalue));
+			Reference &&result = share_boolean(lvalue.data<Boolean>()->value <= to_boolean(rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -937,15 +945,14 @@ void mint::ge_operator(Cursor *cursor) {
 		break;
 	case Data::FMT_NUMBER:
 		{
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Number>()->value
-																>= to_number(cursor, rvalue));
+			Reference &&result = share_boolean(lvalue.data<Number>()->value >= to_number(cursor, rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
 		break;
 	case Data::FMT_BOOLEAN:
 		{
-			Reference &&result = WeakReference::create<Boolean>(lvalue.data<Boolean>()->value >= to_boolean(rvalue));
+			Reference &&result = share_boolean(lvalue.data<Boolean>()->value >= to_boolean(rvalue));
 			cursor->stack().pop_back();
 			cursor->stack().back() = std::move(result);
 		}
@@ -1295,17 +1302,17 @@ void mint::not_operator(Cursor *cursor) {
 	switch (value.data()->format) {
 	case Data::FMT_NONE:
 	case Data::FMT_NULL:
-		cursor->stack().back() = WeakReference::create<Boolean>(true);
+		cursor->stack().back() = share_boolean(true);
 		break;
 	case Data::FMT_NUMBER:
-		cursor->stack().back() = WeakReference::create<Boolean>(value.data<Number>()->value == 0.);
+		cursor->stack().back() = share_boolean(value.data<Number>()->value == 0.);
 		break;
 	case Data::FMT_BOOLEAN:
-		cursor->stack().back() = WeakReference::create<Boolean>(!value.data<Boolean>()->value);
+		cursor->stack().back() = share_boolean(!value.data<Boolean>()->value);
 		break;
 	case Data::FMT_OBJECT:
 		if (!call_overload(cursor, Class::NOT_OPERATOR, 0)) {
-			cursor->stack().back() = WeakReference::create<Boolean>(!to_boolean(value));
+			cursor->stack().back() = share_boolean(!to_boolean(value));
 		}
 		break;
 	case Data::FMT_PACKAGE:
@@ -1783,21 +1790,19 @@ void mint::strict_eq_operator(Cursor *cursor) {
 		case Data::FMT_NULL:
 			{
 				cursor->stack().pop_back();
-				cursor->stack().back() = WeakReference::create<Boolean>(true);
+				cursor->stack().back() = share_boolean(true);
 			}
 			break;
 		case Data::FMT_NUMBER:
 			{
-				Reference &&result = WeakReference::create<Boolean>(lvalue.data<Number>()->value
-																	== rvalue.data<Number>()->value);
+				Reference &&result = share_boolean(lvalue.data<Number>()->value == rvalue.data<Number>()->value);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
 			break;
 		case Data::FMT_BOOLEAN:
 			{
-				Reference &&result = WeakReference::create<Boolean>(lvalue.data<Boolean>()->value
-																	== rvalue.data<Boolean>()->value);
+				Reference &&result = share_boolean(lvalue.data<Boolean>()->value == rvalue.data<Boolean>()->value);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
@@ -1811,8 +1816,8 @@ void mint::strict_eq_operator(Cursor *cursor) {
 			error("invalid use of package in an operation");
 		case Data::FMT_FUNCTION:
 			{
-				Reference &&result = WeakReference::create<Boolean>(lvalue.data<Function>()->mapping
-																	== rvalue.data<Function>()->mapping);
+				Reference &&result = share_boolean(lvalue.data<Function>()->mapping
+												   == rvalue.data<Function>()->mapping);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
@@ -1820,7 +1825,7 @@ void mint::strict_eq_operator(Cursor *cursor) {
 	}
 	else {
 		cursor->stack().pop_back();
-		cursor->stack().back() = WeakReference::create<Boolean>(false);
+		cursor->stack().back() = share_boolean(false);
 	}
 }
 
@@ -1837,21 +1842,19 @@ void mint::strict_ne_operator(Cursor *cursor) {
 		case Data::FMT_NULL:
 			{
 				cursor->stack().pop_back();
-				cursor->stack().back() = WeakReference::create<Boolean>(false);
+				cursor->stack().back() = share_boolean(false);
 			}
 			break;
 		case Data::FMT_NUMBER:
 			{
-				Reference &&result = WeakReference::create<Boolean>(lvalue.data<Number>()->value
-																	!= rvalue.data<Number>()->value);
+				Reference &&result = share_boolean(lvalue.data<Number>()->value != rvalue.data<Number>()->value);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
 			break;
 		case Data::FMT_BOOLEAN:
 			{
-				Reference &&result = WeakReference::create<Boolean>(lvalue.data<Boolean>()->value
-																	!= rvalue.data<Boolean>()->value);
+				Reference &&result = share_boolean(lvalue.data<Boolean>()->value != rvalue.data<Boolean>()->value);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
@@ -1865,8 +1868,8 @@ void mint::strict_ne_operator(Cursor *cursor) {
 			error("invalid use of package in an operation");
 		case Data::FMT_FUNCTION:
 			{
-				Reference &&result = WeakReference::create<Boolean>(lvalue.data<Function>()->mapping
-																	!= rvalue.data<Function>()->mapping);
+				Reference &&result = share_boolean(lvalue.data<Function>()->mapping
+												   != rvalue.data<Function>()->mapping);
 				cursor->stack().pop_back();
 				cursor->stack().back() = std::move(result);
 			}
@@ -1874,7 +1877,7 @@ void mint::strict_ne_operator(Cursor *cursor) {
 	}
 	else {
 		cursor->stack().pop_back();
-		cursor->stack().back() = WeakReference::create<Boolean>(true);
+		cursor->stack().back() = share_boolean(true);
 	}
 }
 
@@ -28,36 +28,9 @@ using namespace mint;
 LocalPool<Reference::Info> Reference::g_pool;
 GarbageCollector &Reference::g_garbage_collector = GarbageCollector::instance();
 
-Reference::Reference(Flags flags, Data *data) :
-	m_info(g_pool.alloc()) {
-	m_info->flags = flags;
-	g_garbage_collector.use(m_info->data = data ? data : g_garbage_collector.alloc<None>());
-	m_info->refcount = 1;
-	assert(m_info->data);
-}
-
-Reference::Reference(Reference &&other) noexcept :
-	m_info(other.m_info) {
-	++m_info->refcount;
-	assert(m_info->data);
-}
-
-Reference::Reference(Info *infos) noexcept :
-	m_info(infos) {
-	++m_info->refcount;
-	assert(m_info->data);
-}
-
-Reference::~Reference() {
-	assert(m_info);
-	if (!--m_info->refcount) {
-		assert(m_info->data);
-		g_garbage_collector.release(m_info->data);
-		g_pool.free(m_info);
-	}
-}
-
 Reference &Reference::operator=(Reference &&other) noexcept {
+	g_garbage_collector.barrier(m_info->data);
+	g_garbage_collector.barrier(other.m_info->data);
 	std::swap(m_info, other.m_info);
 	assert(m_info->data);
 	return *this;
@@ -84,25 +57,6 @@ Reference::Info *Reference::info() {
 	return m_info;
 }
 
-WeakReference::WeakReference(Flags flags, Data *data) :
-	Reference(flags, data) {}
-
-WeakReference::WeakReference(WeakReference &&other) noexcept :
-	Reference(std::forward<WeakReference>(other)) {}
-
-WeakReference::WeakReference(Reference &&other) noexcept :
-	Reference(std::move(other)) {}
-
-WeakReference::WeakReference(Info *infos) :
-	Reference(infos) {}
-
-WeakReference::~WeakReference() {}
-
-WeakReference &WeakReference::operator=(WeakReference &&other) noexcept {
-	Reference::operator=(std::forward<WeakReference>(other));
-	return *this;
-}
-
 StrongReference::StrongReference(Flags flags, Data *data) :
 	Reference(flags, data) {}
 
@@ -29,11 +29,10 @@
 using namespace mint;
 
 SymbolTable::SymbolTable(Class *metadata) :
-	m_metadata(metadata),
-	m_fasts(nullptr) {}
+	m_metadata(metadata) {}
 
 SymbolTable::~SymbolTable() {
-	delete[] m_fasts;
+	release_fast();
 }
 
 Class *SymbolTable::get_metadata() const {
@@ -49,11 +48,24 @@ PackageData *SymbolTable::get_package() const {
 	return m_package.back();
 }
 
+void SymbolTable::release_fast() {
+
+	if (m_owns_fasts) {
+		delete[] m_fasts;
+	}
+	else if (m_fasts) {
+		std::destroy_n(m_fasts, m_fast_count);
+	}
+
+	m_fasts = nullptr;
+	m_fast_count = 0;
+	m_owns_fasts = false;
+}
+
 WeakReference &SymbolTable::create_fast_reference(const Symbol &name, size_t index) {
-	return *(m_fasts[index] = std::make_unique<WeakReference>(get_symbol(this, name)));
+	return m_fasts[index].emplace(get_symbol(this, name));
 }
 
 WeakReference &SymbolTable::create_fast_reference(Reference::Flags flags, const Symbol &name, size_t index) {
-	return *(m_fasts[index] = std::make_unique<WeakReference>(
-				 WeakReference::share(m_symbols.emplace(name, WeakReference(flags)).first->second)));
+	return m_fasts[index].emplace(WeakReference::share(m_symbols.emplace(name, WeakReference(flags)).first->second));
 }
@@ -32,344 +32,730 @@
 #include "mint/memory/builtin/hash.h"
 #include "mint/memory/builtin/iterator.h"
 #include "mint/memory/builtin/library.h"
+#include "mint/memory/builtin/string.h"
 #include "mint/memory/operatortool.h"
 #include "mint/memory/memorytool.h"
+#include "mint/memory/functiontool.h"
+#include "mint/memory/membercache.h"
 #include "mint/memory/casttool.h"
 #include "mint/memory/globaldata.h"
 
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <deque>
+#include <mutex>
+
 using namespace mint;
 
+#if defined(MINT_THREADED_DISPATCH) && (defined(__GNUC__) || defined(__clang__))
+#define MINT_COMPUTED_GOTO
+#define MINT_OPCODE(command) op_##command
+#define MINT_DISPATCH() \
+	if (UNLIKELY(!count--)) { \
+		return true; \
+	} \
+	goto *DISPATCH_TABLE[cursor->next().command]
+#else
+#define MINT_OPCODE(command) case Node::command
+#define MINT_DISPATCH() break
+#endif
+
 static constexpr const size_t QUANTUM = 64 * 1024;
+static constexpr const size_t SLICE_CHECK_INTERVAL = 1024;
+static constexpr const std::chrono::milliseconds SWITCH_INTERVAL(5);
 static std::atomic_bool g_single_thread(true);
-static std::mutex g_step_mutex;
 
 namespace {
 
+struct ProcessorLock {
+	struct Waiter {
+		std::condition_variable condition;
+		bool ready = false;
+	};
+
+	std::mutex mutex;
+	std::deque<Waiter *> waiters;
+	std::atomic_bool switch_requested = false;
+	bool locked = false;
+	ProcessorLockStatistics statistics = {};
+};
+
+ProcessorLock g_processor_lock;
+
+template<class Compare>
+void compare_jump_zero(Cursor *cursor, void (*compare_operator)(Cursor *), Compare compare) {
+
+	const size_t base = get_stack_base(cursor);
+
+	Reference &rvalue = load_from_stack(cursor, base);
+	Reference &lvalue = load_from_stack(cursor, base - 1);
+
+	if (lvalue.data()->format == Data::FMT_NUMBER && rvalue.data()->format == Data::FMT_NUMBER) {
+		const bool result = compare(lvalue.data<Number>()->value, rvalue.data<Number>()->value);
+		cursor->stack().pop_back();
+		cursor->stack().pop_back();
+		((void)cursor->next());
+		if (result) {
+			((void)cursor->next());
+		}
+		else {
+			cursor->jmp(static_cast<size_t>(cursor->next().parameter));
+		}
+	}
+	else {
+		compare_operator(cursor);
+	}
+}
+
+template<class Operation>
+void move_number_operation(Cursor *cursor, void (*number_operator)(Cursor *), Operation operation) {
+
+	const size_t base = get_stack_base(cursor);
+
+	Reference &rvalue = load_from_stack(cursor, base);
+	Reference &lvalue = load_from_stack(cursor, base - 1);
+	Reference &target = load_from_stack(cursor, base - 2);
+
+	if (lvalue.data()->format == Data::FMT_NUMBER && rvalue.data()->format == Data::FMT_NUMBER
+		&& target.data()->format == Data::FMT_NUMBER && target.data()->is_unique()
+		&& !(target.flags() & (Reference::CONST_ADDRESS | Reference::CONST_VALUE | Reference::TEMPORARY))) {
+		target.data<Number>()->value = operation(lvalue.data<Number>()->value, rvalue.data<Number>()->value);
+		cursor->stack().pop_back();
+		cursor->stack().pop_back();
+		((void)cursor->next());
+	}
+	else {
+		number_operator(cursor);
+	}
+}
+
+bool is_number_pair(const Reference &lvalue, const Reference &rvalue) {
+	return lvalue.data()->format == Data::FMT_NUMBER && rvalue.data()->format == Data::FMT_NUMBER;
+}
+
+bool is_string_pair(const Reference &lvalue, const Reference &rvalue) {
+	return is_instance_of(lvalue, Class::STRING) && is_object(lvalue.data<Object>())
+		   && is_instance_of(rvalue, Class::STRING) && is_object(rvalue.data<Object>());
+}
+
+void quicken_operation(Cursor *cursor, Node::Command number_command) {
+
+	const size_t base = get_stack_base(cursor);
+
+	const Reference &rvalue = load_from_stack(cursor, base);
+	const Reference &lvalue = load_from_stack(cursor, base - 1);
+
+	if (is_number_pair(lvalue, rvalue)) {
+		cursor->replace_command(number_command);
+	}
+}
+
+void quicken_operation(Cursor *cursor, Node::Command number_command, Node::Command string_command) {
+
+	const size_t base = get_stack_base(cursor);
+
+	const Reference &rvalue = load_from_stack(cursor, base);
+	const Reference &lvalue = load_from_stack(cursor, base - 1);
+
+	if (is_number_pair(lvalue, rvalue)) {
+		cursor->replace_command(number_command);
+	}
+	else if (is_string_pair(lvalue, rvalue)) {
+		cursor->replace_command(string_command);
+	}
+}
+
+template<class Operation>
+void number_operation(Cursor *cursor, Node::Command generic_command, void (*generic_operator)(Cursor *),
+					  Operation operation) {
+
+	const size_t base = get_stack_base(cursor);
+
+	Reference &rvalue = load_from_stack(cursor, base);
+	Reference &lvalue = load_from_stack(cursor, base - 1);
+
+	if (UNLIKELY(!is_number_pair(lvalue, rvalue))) {
+		cursor->replace_command(generic_command);
+		generic_operator(cursor);
+	}
+	else if (lvalue.flags() & Reference::TEMPORARY) {
+		lvalue.data<Number>()->value = operation(lvalue.data<Number>()->value, rvalue.data<Number>()->value);
+		cursor->stack().pop_back();
+	}
+	else if (rvalue.flags() & Reference::TEMPORARY) {
+		rvalue.data<Number>()->value = operation(lvalue.data<Number>()->value, rvalue.data<Number>()->value);
+		lvalue = std::move(rvalue);
+		cursor->stack().pop_back();
+	}
+	else {
+		WeakReference result = WeakReference::create<Number>(operation(lvalue.data<Number>()->value,
+																	   rvalue.data<Number>()->value));
+		cursor->stack().pop_back();
+		cursor->stack().back() = std::move(result);
+	}
+}
+
+template<class Compare>
+void number_comparison(Cursor *cursor, Node::Command generic_command, void (*generic_operator)(Cursor *),
+					   Compare compare) {
+
+	const size_t base = get_stack_base(cursor);
+
+	Reference &rvalue = load_from_stack(cursor, base);
+	Reference &lvalue = load_from_stack(cursor, base - 1);
+
+	if (UNLIKELY(!is_number_pair(lvalue, rvalue))) {
+		cursor->replace_command(generic_command);
+		generic_operator(cursor);
+	}
+	else {
+		WeakReference result = share_boolean(compare(lvalue.data<Number>()->value, rvalue.data<Number>()->value));
+		cursor->stack().pop_back();
+		cursor->stack().back() = std::move(result);
+	}
+}
+
+template<class Compare>
+void string_comparison(Cursor *cursor, Node::Command generic_command, void (*generic_operator)(Cursor *),
+					   Compare compare) {
+
+	const size_t base = get_stack_base(cursor);
+
+	Reference &rvalue = load_from_stack(cursor, base);
+	Reference &lvalue = load_from_stack(cursor, base - 1);
+
+	if (UNLIKELY(!is_string_pair(lvalue, rvalue))) {
+		cursor->replace_command(generic_command);
+		generic_operator(cursor);
+	}
+	else {
+		WeakReference result = share_boolean(compare(lvalue.data<String>()->str, rvalue.data<String>()->str));
+		cursor->stack().pop_back();
+		cursor->stack().back() = std::move(result);
+	}
+}
+
+void string_concatenation(Cursor *cursor) {
+
+	const size_t base = get_stack_base(cursor);
+
+	Reference &rvalue = load_from_stack(cursor, base);
+	Reference &lvalue = load_from_stack(cursor, base - 1);
+
+	if (UNLIKELY(!is_string_pair(lvalue, rvalue))) {
+		cursor->replace_command(Node::ADD_OP);
+		add_operator(cursor);
+	}
+	else {
+		WeakReference result = create_string(lvalue.data<String>()->str + rvalue.data<String>()->str);
+		cursor->stack().pop_back();
+		cursor->stack().back() = std::move(result);
+	}
+}
+
+void collect_at_safe_point() {
+
+	// the cursor is between two instructions, every live data is reachable
+	// from a stack or a root
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+	if (UNLIKELY(garbage_collector.collection_requested())) {
+		garbage_collector.collect_if_requested();
+	}
+}
+
 bool do_run_steps(Cursor *cursor, size_t count) {
 
 	auto &stack = cursor->stack();
 	AbstractSyntaxTree *ast = cursor->ast();
 
+#ifdef MINT_COMPUTED_GOTO
+	static const void *const DISPATCH_TABLE[] = {
+		&&MINT_OPCODE(LOAD_MODULE),
+		&&MINT_OPCODE(LOAD_FAST),
+		&&MINT_OPCODE(LOAD_SYMBOL),
+		&&MINT_OPCODE(LOAD_MEMBER),
+		&&MINT_OPCODE(LOAD_OPERATOR),
+		&&MINT_OPCODE(LOAD_CONSTANT),
+		&&MINT_OPCODE(LOAD_VAR_SYMBOL),
+		&&MINT_OPCODE(LOAD_VAR_MEMBER),
+		&&MINT_OPCODE(CLONE_REFERENCE),
+		&&MINT_OPCODE(RELOAD_REFERENCE),
+		&&MINT_OPCODE(UNLOAD_REFERENCE),
+		&&MINT_OPCODE(LOAD_EXTRA_ARGUMENTS),
+		&&MINT_OPCODE(RESET_SYMBOL),
+		&&MINT_OPCODE(RESET_FAST),
+		&&MINT_OPCODE(DECLARE_FAST),
+		&&MINT_OPCODE(DECLARE_SYMBOL),
+		&&MINT_OPCODE(DECLARE_FUNCTION),
+		&&MINT_OPCODE(FUNCTION_OVERLOAD),
+		&&MINT_OPCODE(ALLOC_ITERATOR),
+		&&MINT_OPCODE(INIT_ITERATOR),
+		&&MINT_OPCODE(ALLOC_ARRAY),
+		&&MINT_OPCODE(INIT_ARRAY),
+		&&MINT_OPCODE(ALLOC_HASH),
+		&&MINT_OPCODE(INIT_HASH),
+		&&MINT_OPCODE(CREATE_LIB),
+		&&MINT_OPCODE(REGEX_MATCH),
+		&&MINT_OPCODE(REGEX_UNMATCH),
+		&&MINT_OPCODE(STRICT_EQ_OP),
+		&&MINT_OPCODE(STRICT_NE_OP),
+		&&MINT_OPCODE(OPEN_PACKAGE),
+		&&MINT_OPCODE(CLOSE_PACKAGE),
+		&&MINT_OPCODE(REGISTER_CLASS),
+		&&MINT_OPCODE(MOVE_OP),
+		&&MINT_OPCODE(COPY_OP),
+		&&MINT_OPCODE(ADD_OP),
+		&&MINT_OPCODE(SUB_OP),
+		&&MINT_OPCODE(MOD_OP),
+		&&MINT_OPCODE(MUL_OP),
+		&&MINT_OPCODE(DIV_OP),
+		&&MINT_OPCODE(POW_OP),
+		&&MINT_OPCODE(IS_OP),
+		&&MINT_OPCODE(EQ_OP),
+		&&MINT_OPCODE(NE_OP),
+		&&MINT_OPCODE(LT_OP),
+		&&MINT_OPCODE(GT_OP),
+		&&MINT_OPCODE(LE_OP),
+		&&MINT_OPCODE(GE_OP),
+		&&MINT_OPCODE(INC_OP),
+		&&MINT_OPCODE(DEC_OP),
+		&&MINT_OPCODE(NOT_OP),
+		&&MINT_OPCODE(AND_OP),
+		&&MINT_OPCODE(OR_OP),
+		&&MINT_OPCODE(BAND_OP),
+		&&MINT_OPCODE(BOR_OP),
+		&&MINT_OPCODE(XOR_OP),
+		&&MINT_OPCODE(COMPL_OP),
+		&&MINT_OPCODE(POS_OP),
+		&&MINT_OPCODE(NEG_OP),
+		&&MINT_OPCODE(SHIFT_LEFT_OP),
+		&&MINT_OPCODE(SHIFT_RIGHT_OP),
+		&&MINT_OPCODE(INCLUSIVE_RANGE_OP),
+		&&MINT_OPCODE(EXCLUSIVE_RANGE_OP),
+		&&MINT_OPCODE(SUBSCRIPT_OP),
+		&&MINT_OPCODE(SUBSCRIPT_MOVE_OP),
+		&&MINT_OPCODE(TYPEOF_OP),
+		&&MINT_OPCODE(MEMBERSOF_OP),
+		&&MINT_OPCODE(FIND_OP),
+		&&MINT_OPCODE(IN_OP),
+		&&MINT_OPCODE(FIND_DEFINED_SYMBOL),
+		&&MINT_OPCODE(FIND_DEFINED_MEMBER),
+		&&MINT_OPCODE(FIND_DEFINED_VAR_SYMBOL),
+		&&MINT_OPCODE(FIND_DEFINED_VAR_MEMBER),
+		&&MINT_OPCODE(CHECK_DEFINED),
+		&&MINT_OPCODE(FIND_INIT),
+		&&MINT_OPCODE(FIND_NEXT),
+		&&MINT_OPCODE(FIND_CHECK),
+		&&MINT_OPCODE(RANGE_INIT),
+		&&MINT_OPCODE(RANGE_NEXT),
+		&&MINT_OPCODE(RANGE_CHECK),
+		&&MINT_OPCODE(RANGE_ITERATOR_CHECK),
+		&&MINT_OPCODE(BEGIN_GENERATOR_EXPRESSION),
+		&&MINT_OPCODE(END_GENERATOR_EXPRESSION),
+		&&MINT_OPCODE(YIELD_EXPRESSION),
+		&&MINT_OPCODE(OPEN_PRINTER),
+		&&MINT_OPCODE(CLOSE_PRINTER),
+		&&MINT_OPCODE(PRINT),
+		&&MINT_OPCODE(OR_PRE_CHECK),
+		&&MINT_OPCODE(AND_PRE_CHECK),
+		&&MINT_OPCODE(CASE_JUMP),
+		&&MINT_OPCODE(JUMP_ZERO),
+		&&MINT_OPCODE(JUMP),
+		&&MINT_OPCODE(SET_RETRIEVE_POINT),
+		&&MINT_OPCODE(UNSET_RETRIEVE_POINT),
+		&&MINT_OPCODE(RAISE),
+		&&MINT_OPCODE(YIELD),
+		&&MINT_OPCODE(EXIT_GENERATOR),
+		&&MINT_OPCODE(YIELD_EXIT_GENERATOR),
+		&&MINT_OPCODE(INIT_CAPTURE),
+		&&MINT_OPCODE(CAPTURE_SYMBOL),
+		&&MINT_OPCODE(CAPTURE_AS),
+		&&MINT_OPCODE(CAPTURE_ALL),
+		&&MINT_OPCODE(CALL),
+		&&MINT_OPCODE(CALL_MEMBER),
+		&&MINT_OPCODE(CALL_BUILTIN),
+		&&MINT_OPCODE(INIT_CALL),
+		&&MINT_OPCODE(INIT_MEMBER_CALL),
+		&&MINT_OPCODE(INIT_OPERATOR_CALL),
+		&&MINT_OPCODE(INIT_VAR_MEMBER_CALL),
+		&&MINT_OPCODE(INIT_EXCEPTION),
+		&&MINT_OPCODE(RESET_EXCEPTION),
+		&&MINT_OPCODE(INIT_PARAM),
+		&&MINT_OPCODE(EXIT_CALL),
+		&&MINT_OPCODE(EXIT_THREAD),
+		&&MINT_OPCODE(EXIT_EXEC),
+		&&MINT_OPCODE(EXIT_MODULE),
+		&&MINT_OPCODE(LOAD_FAST_LOAD_FAST),
+		&&MINT_OPCODE(LOAD_FAST_LOAD_CONSTANT),
+		&&MINT_OPCODE(LOAD_FAST_LOAD_MEMBER),
+		&&MINT_OPCODE(ADD_OP_MOVE_OP),
+		&&MINT_OPCODE(SUB_OP_MOVE_OP),
+		&&MINT_OPCODE(MUL_OP_MOVE_OP),
+		&&MINT_OPCODE(MOVE_OP_UNLOAD_REFERENCE),
+		&&MINT_OPCODE(EQ_OP_JUMP_ZERO),
+		&&MINT_OPCODE(NE_OP_JUMP_ZERO),
+		&&MINT_OPCODE(LT_OP_JUMP_ZERO),
+		&&MINT_OPCODE(GT_OP_JUMP_ZERO),
+		&&MINT_OPCODE(LE_OP_JUMP_ZERO),
+		&&MINT_OPCODE(GE_OP_JUMP_ZERO),
+		&&MINT_OPCODE(INIT_MEMBER_CALL_MEMBER),
+		&&MINT_OPCODE(ADD_NUMBER_NUMBER),
+		&&MINT_OPCODE(SUB_NUMBER_NUMBER),
+		&&MINT_OPCODE(MUL_NUMBER_NUMBER),
+		&&MINT_OPCODE(DIV_NUMBER_NUMBER),
+		&&MINT_OPCODE(EQ_NUMBER_NUMBER),
+		&&MINT_OPCODE(NE_NUMBER_NUMBER),
+		&&MINT_OPCODE(LT_NUMBER_NUMBER),
+		&&MINT_OPCODE(GT_NUMBER_NUMBER),
+		&&MINT_OPCODE(LE_NUMBER_NUMBER),
+		&&MINT_OPCODE(GE_NUMBER_NUMBER),
+		&&MINT_OPCODE(ADD_STRING_STRING),
+		&&MINT_OPCODE(EQ_STRING_STRING),
+		&&MINT_OPCODE(NE_STRING_STRING),
+	};
+
+	static_assert(std::size(DISPATCH_TABLE) == Node::NE_STRING_STRING + 1);
+
+	MINT_DISPATCH();
+	{
+		{
+#else
 	while (count--) {
 		switch (cursor->next().command) {
-		case Node::LOAD_MODULE:
+#endif
+		MINT_OPCODE(LOAD_MODULE):
 			load_module(cursor, cursor->next().symbol->str());
-			break;
+			MINT_DISPATCH();
 
-		case Node::LOAD_FAST:
+		MINT_OPCODE(LOAD_FAST):
 			{
 				Symbol &symbol = *cursor->next().symbol;
 				const auto index = static_cast<size_t>(cursor->next().parameter);
 				stack.emplace_back(cursor->symbols().get_fast(symbol, index));
 			}
-			break;
-		case Node::LOAD_SYMBOL:
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_SYMBOL):
 			stack.emplace_back(get_symbol(&cursor->symbols(), *cursor->next().symbol));
-			break;
-		case Node::LOAD_MEMBER:
-			reduce_member(cursor, get_member(cursor, stack.back(), *cursor->next().symbol));
-			break;
-		case Node::LOAD_OPERATOR:
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_MEMBER):
+			{
+				Symbol &symbol = *cursor->next().symbol;
+				MemberCache *cache = cursor->next().cache;
+				reduce_member(cursor, get_member(cursor, stack.back(), symbol, cache));
+			}
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_OPERATOR):
 			reduce_member(cursor,
 						  get_operator(cursor, stack.back(), static_cast<Class::Operator>(cursor->next().parameter)));
-			break;
-		case Node::LOAD_CONSTANT:
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_CONSTANT):
 			stack.emplace_back(WeakReference::share(*cursor->next().constant));
-			break;
-		case Node::LOAD_VAR_SYMBOL:
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_VAR_SYMBOL):
 			stack.emplace_back(get_symbol(&cursor->symbols(), var_symbol(cursor)));
-			break;
-		case Node::LOAD_VAR_MEMBER:
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_VAR_MEMBER):
 			{
 				Symbol &&symbol = var_symbol(cursor);
 				reduce_member(cursor, get_member(cursor, stack.back(), symbol));
 			}
-			break;
-		case Node::CLONE_REFERENCE:
+			MINT_DISPATCH();
+		MINT_OPCODE(CLONE_REFERENCE):
 			{
 				WeakReference reference = std::move(stack.back());
 				stack.back() = WeakReference::clone(reference);
 				stack.emplace_back(std::forward<Reference>(reference));
 			}
-			break;
-		case Node::RELOAD_REFERENCE:
+			MINT_DISPATCH();
+		MINT_OPCODE(RELOAD_REFERENCE):
 			stack.emplace_back(WeakReference::share(stack.back()));
-			break;
-		case Node::UNLOAD_REFERENCE:
+			MINT_DISPATCH();
+		MINT_OPCODE(UNLOAD_REFERENCE):
 			stack.pop_back();
-			break;
-		case Node::LOAD_EXTRA_ARGUMENTS:
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_EXTRA_ARGUMENTS):
 			load_extra_arguments(cursor);
-			break;
-		case Node::RESET_SYMBOL:
+			MINT_DISPATCH();
+		MINT_OPCODE(RESET_SYMBOL):
 			cursor->symbols().erase(*cursor->next().symbol);
-			break;
-		case Node::RESET_FAST:
+			MINT_DISPATCH();
+		MINT_OPCODE(RESET_FAST):
 			{
 				const Symbol &symbol = *cursor->next().symbol;
 				const auto index = static_cast<size_t>(cursor->next().parameter);
 				cursor->symbols().erase_fast(symbol, index);
 			}
-			break;
+			MINT_DISPATCH();
 
-		case Node::DECLARE_FAST:
+		MINT_OPCODE(DECLARE_FAST):
 			{
 				const Symbol &symbol = *cursor->next().symbol;
 				const auto index = static_cast<size_t>(cursor->next().parameter);
 				const auto flags = static_cast<Reference::Flags>(cursor->next().parameter);
 				declare_symbol(cursor, symbol, index, flags);
 			}
-			break;
-		case Node::DECLARE_SYMBOL:
+			MINT_DISPATCH();
+		MINT_OPCODE(DECLARE_SYMBOL):
 			{
 				const Symbol &symbol = *cursor->next().symbol;
 				const auto flags = static_cast<Reference::Flags>(cursor->next().parameter);
 				declare_symbol(cursor, symbol, flags);
 			}
-			break;
-		case Node::DECLARE_FUNCTION:
+			MINT_DISPATCH();
+		MINT_OPCODE(DECLARE_FUNCTION):
 			{
 				const Symbol &symbol = *cursor->next().symbol;
 				const auto flags = static_cast<Reference::Flags>(cursor->next().parameter);
 				declare_function(cursor, symbol, flags);
 			}
-			break;
-		case Node::FUNCTION_OVERLOAD:
+			MINT_DISPATCH();
+		MINT_OPCODE(FUNCTION_OVERLOAD):
 			function_overload_from_stack(cursor);
-			break;
-		case Node::ALLOC_ITERATOR:
+			MINT_DISPATCH();
+		MINT_OPCODE(ALLOC_ITERATOR):
 			cursor->waiting_calls().emplace(
 				WeakReference(Reference::CONST_ADDRESS, GarbageCollector::instance().alloc<Iterator>()));
-			break;
-		case Node::INIT_ITERATOR:
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_ITERATOR):
 			iterator_new(cursor, static_cast<size_t>(cursor->next().parameter));
-			break;
-		case Node::ALLOC_ARRAY:
+			MINT_DISPATCH();
+		MINT_OPCODE(ALLOC_ARRAY):
 			cursor->waiting_calls().emplace(
 				WeakReference(Reference::CONST_ADDRESS, GarbageCollector::instance().alloc<Array>()));
-			break;
-		case Node::INIT_ARRAY:
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_ARRAY):
 			array_new(cursor, static_cast<size_t>(cursor->next().parameter));
-			break;
-		case Node::ALLOC_HASH:
+			MINT_DISPATCH();
+		MINT_OPCODE(ALLOC_HASH):
 			cursor->waiting_calls().emplace(
 				WeakReference(Reference::CONST_ADDRESS, GarbageCollector::instance().alloc<Hash>()));
-			break;
-		case Node::INIT_HASH:
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_HASH):
 			hash_new(cursor, static_cast<size_t>(cursor->next().parameter));
-			break;
-		case Node::CREATE_LIB:
+			MINT_DISPATCH();
+		MINT_OPCODE(CREATE_LIB):
 			stack.emplace_back(WeakReference::create<Library>());
-			break;
+			MINT_DISPATCH();
 
-		case Node::REGEX_MATCH:
+		MINT_OPCODE(REGEX_MATCH):
 			regex_match(cursor);
-			break;
-		case Node::REGEX_UNMATCH:
+			MINT_DISPATCH();
+		MINT_OPCODE(REGEX_UNMATCH):
 			regex_unmatch(cursor);
-			break;
+			MINT_DISPATCH();
 
-		case Node::STRICT_EQ_OP:
+		MINT_OPCODE(STRICT_EQ_OP):
 			strict_eq_operator(cursor);
-			break;
-		case Node::STRICT_NE_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(STRICT_NE_OP):
 			strict_ne_operator(cursor);
-			break;
+			MINT_DISPATCH();
 
-		case Node::OPEN_PACKAGE:
+		MINT_OPCODE(OPEN_PACKAGE):
 			cursor->symbols().open_package(cursor->next().constant->data<Package>()->data);
-			break;
-		case Node::CLOSE_PACKAGE:
+			MINT_DISPATCH();
+		MINT_OPCODE(CLOSE_PACKAGE):
 			cursor->symbols().close_package();
-			break;
-		case Node::REGISTER_CLASS:
+			MINT_DISPATCH();
+		MINT_OPCODE(REGISTER_CLASS):
 			cursor->symbols().get_package()->register_class(static_cast<ClassRegister::Id>(cursor->next().parameter));
-			break;
+			MINT_DISPATCH();
 
-		case Node::MOVE_OP:
+		MINT_OPCODE(MOVE_OP):
 			move_operator(cursor);
-			break;
-		case Node::COPY_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(COPY_OP):
 			copy_operator(cursor);
-			break;
-		case Node::ADD_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(ADD_OP):
+			quicken_operation(cursor, Node::ADD_NUMBER_NUMBER, Node::ADD_STRING_STRING);
 			add_operator(cursor);
-			break;
-		case Node::SUB_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(SUB_OP):
+			quicken_operation(cursor, Node::SUB_NUMBER_NUMBER);
 			sub_operator(cursor);
-			break;
-		case Node::MOD_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(MOD_OP):
 			mod_operator(cursor);
-			break;
-		case Node::MUL_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(MUL_OP):
+			quicken_operation(cursor, Node::MUL_NUMBER_NUMBER);
 			mul_operator(cursor);
-			break;
-		case Node::DIV_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(DIV_OP):
+			quicken_operation(cursor, Node::DIV_NUMBER_NUMBER);
 			div_operator(cursor);
-			break;
-		case Node::POW_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(POW_OP):
 			pow_operator(cursor);
-			break;
-		case Node::IS_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(IS_OP):
 			is_operator(cursor);
-			break;
-		case Node::EQ_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(EQ_OP):
+			quicken_operation(cursor, Node::EQ_NUMBER_NUMBER, Node::EQ_STRING_STRING);
 			eq_operator(cursor);
-			break;
-		case Node::NE_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(NE_OP):
+			quicken_operation(cursor, Node::NE_NUMBER_NUMBER, Node::NE_STRING_STRING);
 			ne_operator(cursor);
-			break;
-		case Node::LT_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(LT_OP):
+			quicken_operation(cursor, Node::LT_NUMBER_NUMBER);
 			lt_operator(cursor);
-			break;
-		case Node::GT_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(GT_OP):
+			quicken_operation(cursor, Node::GT_NUMBER_NUMBER);
 			gt_operator(cursor);
-			break;
-		case Node::LE_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(LE_OP):
+			quicken_operation(cursor, Node::LE_NUMBER_NUMBER);
 			le_operator(cursor);
-			break;
-		case Node::GE_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(GE_OP):
+			quicken_operation(cursor, Node::GE_NUMBER_NUMBER);
 			ge_operator(cursor);
-			break;
-		case Node::INC_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(INC_OP):
 			inc_operator(cursor);
-			break;
-		case Node::DEC_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(DEC_OP):
 			dec_operator(cursor);
-			break;
-		case Node::NOT_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(NOT_OP):
 			not_operator(cursor);
-			break;
-		case Node::AND_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(AND_OP):
 			and_operator(cursor);
-			break;
-		case Node::OR_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(OR_OP):
 			or_operator(cursor);
-			break;
-		case Node::BAND_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(BAND_OP):
 			band_operator(cursor);
-			break;
-		case Node::BOR_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(BOR_OP):
 			bor_operator(cursor);
-			break;
-		case Node::XOR_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(XOR_OP):
 			xor_operator(cursor);
-			break;
-		case Node::COMPL_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(COMPL_OP):
 			compl_operator(cursor);
-			break;
-		case Node::POS_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(POS_OP):
 			pos_operator(cursor);
-			break;
-		case Node::NEG_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(NEG_OP):
 			neg_operator(cursor);
-			break;
-		case Node::SHIFT_LEFT_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(SHIFT_LEFT_OP):
 			shift_left_operator(cursor);
-			break;
-		case Node::SHIFT_RIGHT_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(SHIFT_RIGHT_OP):
 			shift_right_operator(cursor);
-			break;
-		case Node::INCLUSIVE_RANGE_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(INCLUSIVE_RANGE_OP):
 			inclusive_range_operator(cursor);
-			break;
-		case Node::EXCLUSIVE_RANGE_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(EXCLUSIVE_RANGE_OP):
 			exclusive_range_operator(cursor);
-			break;
-		case Node::SUBSCRIPT_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(SUBSCRIPT_OP):
 			subscript_operator(cursor);
-			break;
-		case Node::SUBSCRIPT_MOVE_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(SUBSCRIPT_MOVE_OP):
 			subscript_move_operator(cursor);
-			break;
-		case Node::TYPEOF_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(TYPEOF_OP):
 			typeof_operator(cursor);
-			break;
-		case Node::MEMBERSOF_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(MEMBERSOF_OP):
 			membersof_operator(cursor);
-			break;
-		case Node::FIND_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(FIND_OP):
 			find_operator(cursor);
-			break;
-		case Node::IN_OP:
+			MINT_DISPATCH();
+		MINT_OPCODE(IN_OP):
 			in_operator(cursor);
-			break;
+			MINT_DISPATCH();
 
-		case Node::FIND_DEFINED_SYMBOL:
+		MINT_OPCODE(FIND_DEFINED_SYMBOL):
 			find_defined_symbol(cursor, *cursor->next().symbol);
-			break;
-		case Node::FIND_DEFINED_MEMBER:
+			MINT_DISPATCH();
+		MINT_OPCODE(FIND_DEFINED_MEMBER):
 			find_defined_member(cursor, *cursor->next().symbol);
-			break;
-		case Node::FIND_DEFINED_VAR_SYMBOL:
+			MINT_DISPATCH();
+		MINT_OPCODE(FIND_DEFINED_VAR_SYMBOL):
 			find_defined_symbol(cursor, var_symbol(cursor));
-			break;
-		case Node::FIND_DEFINED_VAR_MEMBER:
+			MINT_DISPATCH();
+		MINT_OPCODE(FIND_DEFINED_VAR_MEMBER):
 			find_defined_member(cursor, var_symbol(cursor));
-			break;
-		case Node::CHECK_DEFINED:
+			MINT_DISPATCH();
+		MINT_OPCODE(CHECK_DEFINED):
 			check_defined(cursor);
-			break;
+			MINT_DISPATCH();
 
-		case Node::FIND_INIT:
+		MINT_OPCODE(FIND_INIT):
 			find_init(cursor);
-			break;
-		case Node::FIND_NEXT:
+			MINT_DISPATCH();
+		MINT_OPCODE(FIND_NEXT):
 			find_next(cursor);
-			break;
-		case Node::FIND_CHECK:
+			MINT_DISPATCH();
+		MINT_OPCODE(FIND_CHECK):
 			find_check(cursor, static_cast<size_t>(cursor->next().parameter));
-			break;
-		case Node::RANGE_INIT:
+			MINT_DISPATCH();
+		MINT_OPCODE(RANGE_INIT):
 			range_init(cursor);
-			break;
-		case Node::RANGE_NEXT:
+			MINT_DISPATCH();
+		MINT_OPCODE(RANGE_NEXT):
 			range_next(cursor);
-			break;
-		case Node::RANGE_CHECK:
+			MINT_DISPATCH();
+		MINT_OPCODE(RANGE_CHECK):
 			range_check(cursor, static_cast<size_t>(cursor->next().parameter));
-			break;
-		case Node::RANGE_ITERATOR_CHECK:
+			MINT_DISPATCH();
+		MINT_OPCODE(RANGE_ITERATOR_CHECK):
 			range_iterator_check(cursor, static_cast<size_t>(cursor->next().parameter));
-			break;
+			MINT_DISPATCH();
 
-		case Node::BEGIN_GENERATOR_EXPRESSION:
+		MINT_OPCODE(BEGIN_GENERATOR_EXPRESSION):
 			cursor->begin_generator_expression();
-			break;
+			MINT_DISPATCH();
 
-		case Node::END_GENERATOR_EXPRESSION:
+		MINT_OPCODE(END_GENERATOR_EXPRESSION):
 			cursor->end_generator_expression();
-			break;
+			MINT_DISPATCH();
 
-		case Node::YIELD_EXPRESSION:
+		MINT_OPCODE(YIELD_EXPRESSION):
 			cursor->yield_expression(stack.back());
 			stack.pop_back();
-			break;
+			MINT_DISPATCH();
 
-		case Node::OPEN_PRINTER:
+		MINT_OPCODE(OPEN_PRINTER):
 			cursor->open_printer(create_printer(cursor));
-			break;
+			MINT_DISPATCH();
 
-		case Node::CLOSE_PRINTER:
+		MINT_OPCODE(CLOSE_PRINTER):
 			cursor->close_printer();
-			break;
+			MINT_DISPATCH();
 
-		case Node::PRINT:
+		MINT_OPCODE(PRINT):
 			{
 				WeakReference reference = std::move(stack.back());
 				stack.pop_back();
 				print(cursor->printer(), reference);
 			}
-			break;
+			MINT_DISPATCH();
 
-		case Node::OR_PRE_CHECK:
+		MINT_OPCODE(OR_PRE_CHECK):
 			or_pre_check(cursor, static_cast<size_t>(cursor->next().parameter));
-			break;
-		case Node::AND_PRE_CHECK:
+			MINT_DISPATCH();
+		MINT_OPCODE(AND_PRE_CHECK):
 			and_pre_check(cursor, static_cast<size_t>(cursor->next().parameter));
-			break;
+			MINT_DISPATCH();
 
-		case Node::CASE_JUMP:
+		MINT_OPCODE(CASE_JUMP):
 			if (to_boolean(stack.back())) {
 				cursor->jmp(static_cast<size_t>(cursor->next().parameter));
 				stack.pop_back();
@@ -378,9 +764,9 @@ bool do_run_steps(Cursor *cursor, size_t count) {
 				((void)cursor->next());
 			}
 			stack.pop_back();
-			break;
+			MINT_DISPATCH();
 
-		case Node::JUMP_ZERO:
+		MINT_OPCODE(JUMP_ZERO):
 			if (to_boolean(stack.back())) {
 				((void)cursor->next());
 			}
@@ -388,98 +774,219 @@ bool do_run_steps(Cursor *cursor, size_t count) {
 				cursor->jmp(static_cast<size_t>(cursor->next().parameter));
 			}
 			stack.pop_back();
-			break;
+			MINT_DISPATCH();
 
-		case Node::JUMP:
+		MINT_OPCODE(JUMP):
 			cursor->jmp(static_cast<size_t>(cursor->next().parameter));
-			break;
+			MINT_DISPATCH();
 
-		case Node::SET_RETRIEVE_POINT:
+		MINT_OPCODE(SET_RETRIEVE_POINT):
 			cursor->set_retrieve_point(static_cast<size_t>(cursor->next().parameter));
-			break;
-		case Node::UNSET_RETRIEVE_POINT:
+			MINT_DISPATCH();
+		MINT_OPCODE(UNSET_RETRIEVE_POINT):
 			cursor->unset_retrieve_point();
-			break;
-		case Node::RAISE:
+			MINT_DISPATCH();
+		MINT_OPCODE(RAISE):
 			{
 				WeakReference exception = std::move(stack.back());
 				stack.pop_back();
 				cursor->raise(std::move(exception));
 			}
-			break;
+			MINT_DISPATCH();
 
-		case Node::YIELD:
+		MINT_OPCODE(YIELD):
 			yield(cursor, cursor->generator());
-			break;
-		case Node::EXIT_GENERATOR:
+			MINT_DISPATCH();
+		MINT_OPCODE(EXIT_GENERATOR):
 			cursor->exit_call();
-			break;
-		case Node::YIELD_EXIT_GENERATOR:
+			MINT_DISPATCH();
+		MINT_OPCODE(YIELD_EXIT_GENERATOR):
 			yield(cursor, cursor->generator());
 			cursor->exit_call();
-			break;
+			MINT_DISPATCH();
 
-		case Node::INIT_CAPTURE:
+		MINT_OPCODE(INIT_CAPTURE):
 			assert(is_instance_of(stack.back(), Data::FMT_FUNCTION));
 			stack.back() = WeakReference::clone(stack.back());
-			break;
-		case Node::CAPTURE_SYMBOL:
+			MINT_DISPATCH();
+		MINT_OPCODE(CAPTURE_SYMBOL):
 			capture_symbol(cursor, *cursor->next().symbol);
-			break;
-		case Node::CAPTURE_AS:
+			MINT_DISPATCH();
+		MINT_OPCODE(CAPTURE_AS):
 			capture_as_symbol(cursor, *cursor->next().symbol);
-			break;
-		case Node::CAPTURE_ALL:
+			MINT_DISPATCH();
+		MINT_OPCODE(CAPTURE_ALL):
 			capture_all_symbols(cursor);
-			break;
-		case Node::CALL:
+			MINT_DISPATCH();
+		MINT_OPCODE(CALL):
 			call_operator(cursor, cursor->next().parameter);
-			break;
-		case Node::CALL_MEMBER:
+			MINT_DISPATCH();
+		MINT_OPCODE(CALL_MEMBER):
 			call_member_operator(cursor, cursor->next().parameter);
-			break;
-		case Node::CALL_BUILTIN:
+			MINT_DISPATCH();
+		MINT_OPCODE(CALL_BUILTIN):
 			ast->call_builtin_method(static_cast<size_t>(cursor->next().parameter), cursor);
-			break;
-		case Node::INIT_CALL:
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_CALL):
 			init_call(cursor);
-			break;
-		case Node::INIT_MEMBER_CALL:
-			init_member_call(cursor, *cursor->next().symbol);
-			break;
-		case Node::INIT_OPERATOR_CALL:
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_MEMBER_CALL):
+			{
+				Symbol &symbol = *cursor->next().symbol;
+				MemberCache *cache = cursor->next().cache;
+				init_member_call(cursor, symbol, cache);
+			}
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_OPERATOR_CALL):
 			init_operator_call(cursor, static_cast<Class::Operator>(cursor->next().parameter));
-			break;
-		case Node::INIT_VAR_MEMBER_CALL:
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_VAR_MEMBER_CALL):
 			init_member_call(cursor, var_symbol(cursor));
-			break;
-		case Node::INIT_EXCEPTION:
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_EXCEPTION):
 			init_exception(cursor, *cursor->next().symbol);
-			break;
-		case Node::RESET_EXCEPTION:
+			MINT_DISPATCH();
+		MINT_OPCODE(RESET_EXCEPTION):
 			reset_exception(cursor, *cursor->next().symbol);
-			break;
-		case Node::INIT_PARAM:
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_PARAM):
 			{
 				const Symbol &symbol = *cursor->next().symbol;
 				const auto flags = static_cast<Reference::Flags>(cursor->next().parameter);
 				const auto index = static_cast<size_t>(cursor->next().parameter);
 				init_parameter(cursor, symbol, flags, index);
 			}
-			break;
-		case Node::EXIT_CALL:
+			MINT_DISPATCH();
+		MINT_OPCODE(EXIT_CALL):
 			cursor->exit_call();
-			break;
-		case Node::EXIT_THREAD:
+			MINT_DISPATCH();
+		MINT_OPCODE(EXIT_THREAD):
 			return false;
-		case Node::EXIT_EXEC:
+		MINT_OPCODE(EXIT_EXEC):
 			Scheduler::instance()->exit(static_cast<int>(to_integer(cursor, stack.back())));
 			stack.pop_back();
 			return false;
-		case Node::EXIT_MODULE:
+		MINT_OPCODE(EXIT_MODULE):
 			if (UNLIKELY(!cursor->exit_module())) {
 				return false;
 			}
+			MINT_DISPATCH();
+
+		MINT_OPCODE(LOAD_FAST_LOAD_FAST):
+			{
+				Symbol &symbol = *cursor->next().symbol;
+				const auto index = static_cast<size_t>(cursor->next().parameter);
+				stack.emplace_back(cursor->symbols().get_fast(symbol, index));
+			}
+			((void)cursor->next());
+			{
+				Symbol &symbol = *cursor->next().symbol;
+				const auto index = static_cast<size_t>(cursor->next().parameter);
+				stack.emplace_back(cursor->symbols().get_fast(symbol, index));
+			}
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_FAST_LOAD_CONSTANT):
+			{
+				Symbol &symbol = *cursor->next().symbol;
+				const auto index = static_cast<size_t>(cursor->next().parameter);
+				stack.emplace_back(cursor->symbols().get_fast(symbol, index));
+			}
+			((void)cursor->next());
+			stack.emplace_back(WeakReference::share(*cursor->next().constant));
+			MINT_DISPATCH();
+		MINT_OPCODE(LOAD_FAST_LOAD_MEMBER):
+			{
+				Symbol &symbol = *cursor->next().symbol;
+				const auto index = static_cast<size_t>(cursor->next().parameter);
+				stack.emplace_back(cursor->symbols().get_fast(symbol, index));
+			}
+			((void)cursor->next());
+			{
+				Symbol &symbol = *cursor->next().symbol;
+				MemberCache *cache = cursor->next().cache;
+				reduce_member(cursor, get_member(cursor, stack.back(), symbol, cache));
+			}
+			MINT_DISPATCH();
+		MINT_OPCODE(ADD_OP_MOVE_OP):
+			move_number_operation(cursor, add_operator, std::plus<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(SUB_OP_MOVE_OP):
+			move_number_operation(cursor, sub_operator, std::minus<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(MUL_OP_MOVE_OP):
+			move_number_operation(cursor, mul_operator, std::multiplies<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(MOVE_OP_UNLOAD_REFERENCE):
+			move_operator(cursor);
+			((void)cursor->next());
+			stack.pop_back();
+			MINT_DISPATCH();
+		MINT_OPCODE(EQ_OP_JUMP_ZERO):
+			compare_jump_zero(cursor, eq_operator, std::equal_to<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(NE_OP_JUMP_ZERO):
+			compare_jump_zero(cursor, ne_operator, std::not_equal_to<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(LT_OP_JUMP_ZERO):
+			compare_jump_zero(cursor, lt_operator, std::less<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(GT_OP_JUMP_ZERO):
+			compare_jump_zero(cursor, gt_operator, std::greater<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(LE_OP_JUMP_ZERO):
+			compare_jump_zero(cursor, le_operator, std::less_equal<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(GE_OP_JUMP_ZERO):
+			compare_jump_zero(cursor, ge_operator, std::greater_equal<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(INIT_MEMBER_CALL_MEMBER):
+			{
+				Symbol &symbol = *cursor->next().symbol;
+				MemberCache *cache = cursor->next().cache;
+				init_member_call(cursor, symbol, cache);
+			}
+			((void)cursor->next());
+			call_member_operator(cursor, cursor->next().parameter);
+			MINT_DISPATCH();
+		MINT_OPCODE(ADD_NUMBER_NUMBER):
+			number_operation(cursor, Node::ADD_OP, add_operator, std::plus<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(SUB_NUMBER_NUMBER):
+			number_operation(cursor, Node::SUB_OP, sub_operator, std::minus<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(MUL_NUMBER_NUMBER):
+			number_operation(cursor, Node::MUL_OP, mul_operator, std::multiplies<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(DIV_NUMBER_NUMBER):
+			number_operation(cursor, Node::DIV_OP, div_operator, std::divides<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(EQ_NUMBER_NUMBER):
+			number_comparison(cursor, Node::EQ_OP, eq_operator, std::equal_to<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(NE_NUMBER_NUMBER):
+			number_comparison(cursor, Node::NE_OP, ne_operator, std::not_equal_to<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(LT_NUMBER_NUMBER):
+			number_comparison(cursor, Node::LT_OP, lt_operator, std::less<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(GT_NUMBER_NUMBER):
+			number_comparison(cursor, Node::GT_OP, gt_operator, std::greater<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(LE_NUMBER_NUMBER):
+			number_comparison(cursor, Node::LE_OP, le_operator, std::less_equal<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(GE_NUMBER_NUMBER):
+			number_comparison(cursor, Node::GE_OP, ge_operator, std::greater_equal<double>());
+			MINT_DISPATCH();
+		MINT_OPCODE(ADD_STRING_STRING):
+			string_concatenation(cursor);
+			MINT_DISPATCH();
+		MINT_OPCODE(EQ_STRING_STRING):
+			string_comparison(cursor, Node::EQ_OP, eq_operator, std::equal_to<std::string>());
+			MINT_DISPATCH();
+		MINT_OPCODE(NE_STRING_STRING):
+			string_comparison(cursor, Node::NE_OP, ne_operator, std::not_equal_to<std::string>());
+			MINT_DISPATCH();
 		}
 	}
 
@@ -514,13 +1021,28 @@ bool mint::run_steps(Cursor *cursor) {
 
 	lock_processor();
 
-	do {
-		if (!do_run_steps(cursor, QUANTUM)) {
-			unlock_processor();
-			return false;
+	if (g_single_thread) {
+		do {
+			if (!do_run_steps(cursor, QUANTUM)) {
+				unlock_processor();
+				return false;
+			}
+			collect_at_safe_point();
 		}
+		while (g_single_thread);
+	}
+	else {
+		// run until a waiting thread requests a switch
+		size_t steps = 0;
+		do {
+			if (!do_run_steps(cursor, SLICE_CHECK_INTERVAL)) {
+				unlock_processor();
+				return false;
+			}
+			collect_at_safe_point();
+		}
+		while (!g_processor_lock.switch_requested && (steps += SLICE_CHECK_INTERVAL) < QUANTUM);
 	}
-	while (g_single_thread);
 
 	unlock_processor();
 	return true;
@@ -544,14 +1066,71 @@ void mint::set_multi_thread(bool enabled) {
 }
 
 void mint::lock_processor() {
-	while (!g_step_mutex.try_lock()) {
-		std::this_thread::yield();
+
+	std::unique_lock<std::mutex> lock(g_processor_lock.mutex);
+	++g_processor_lock.statistics.acquisitions;
+
+	if (!g_processor_lock.locked) {
+		g_processor_lock.locked = true;
+		return;
 	}
+
+	// wait in FIFO order, the owner is requested to hand the lock over if no switch
+	// happened during the switch interval
+	thread_local ProcessorLock::Waiter waiter;
+	waiter.ready = false;
+	g_processor_lock.waiters.push_back(&waiter);
+	++g_processor_lock.statistics.contentions;
+
+	const auto start = std::chrono::steady_clock::now();
+	auto deadline = start + SWITCH_INTERVAL;
+	auto handoffs = g_processor_lock.statistics.handoffs;
+
+	while (!waiter.ready) {
+		if (!g_processor_lock.locked && g_processor_lock.waiters.front() == &waiter) {
+			g_processor_lock.waiters.pop_front();
+			g_processor_lock.switch_requested = false;
+			g_processor_lock.locked = true;
+			break;
+		}
+		if (waiter.condition.wait_until(lock, deadline) == std::cv_status::timeout) {
+			if (handoffs == g_processor_lock.statistics.handoffs) {
+				g_processor_lock.switch_requested = true;
+			}
+			handoffs = g_processor_lock.statistics.handoffs;
+			deadline = std::chrono::steady_clock::now() + SWITCH_INTERVAL;
+		}
+	}
+
+	g_processor_lock.statistics.wait_time += std::chrono::steady_clock::now() - start;
 }
 
 void mint::unlock_processor() {
-	g_step_mutex.unlock();
-	if (!g_single_thread) {
-		std::this_thread::yield();
+
+	std::unique_lock<std::mutex> lock(g_processor_lock.mutex);
+
+	if (g_processor_lock.waiters.empty()) {
+		g_processor_lock.locked = false;
+		return;
+	}
+
+	if (g_processor_lock.switch_requested) {
+		// the lock stays locked and is handed over to the oldest waiter
+		ProcessorLock::Waiter *waiter = g_processor_lock.waiters.front();
+		g_processor_lock.waiters.pop_front();
+		g_processor_lock.switch_requested = false;
+		++g_processor_lock.statistics.handoffs;
+		waiter->ready = true;
+		waiter->condition.notify_one();
 	}
+	else {
+		// the oldest waiter gets the lock unless the owner takes it back first
+		g_processor_lock.locked = false;
+		g_processor_lock.waiters.front()->condition.notify_one();
+	}
+}
+
+ProcessorLockStatistics mint::processor_lock_statistics() {
+	std::unique_lock<std::mutex> lock(g_processor_lock.mutex);
+	return g_processor_lock.statistics;
 }
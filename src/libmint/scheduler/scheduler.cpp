@@ -56,6 +56,31 @@ bool collect_safe() {
 	return collected;
 }
 
+class NestedProcessGuard {
+public:
+	NestedProcessGuard(bool nested) :
+		m_nested(nested) {
+		if (m_nested) {
+			GarbageCollector::instance().suspend_automatic_collection();
+		}
+	}
+
+	NestedProcessGuard(NestedProcessGuard &&) = delete;
+	NestedProcessGuard(const NestedProcessGuard &) = delete;
+
+	~NestedProcessGuard() {
+		if (m_nested) {
+			GarbageCollector::instance().resume_automatic_collection();
+		}
+	}
+
+	NestedProcessGuard &operator=(NestedProcessGuard &&) = delete;
+	NestedProcessGuard &operator=(const NestedProcessGuard &) = delete;
+
+private:
+	bool m_nested;
+};
+
 }
 
 Scheduler::Scheduler(int argc, char **argv) :
@@ -516,6 +541,81 @@ bool Scheduler::parse_arguments(int argc, char **argv) {
 			print_help();
 			return false;
 		}
+		else if (!strcmp(argv[argn], "--gc-threshold")) {
+			if (++argn < argc) {
+				char *end = nullptr;
+				const unsigned long long count = strtoull(argv[argn], &end, 10);
+				if (end == argv[argn] || *end != '\0') {
+					error("Argument is not a valid object count");
+					return false;
+				}
+				GarbageCollector::instance().set_collection_threshold(static_cast<size_t>(count));
+			}
+			else {
+				error("Argument expected for the --gc-threshold option");
+				return false;
+			}
+		}
+		else if (!strcmp(argv[argn], "--gc-growth")) {
+			if (++argn < argc) {
+				char *end = nullptr;
+				const double ratio = strtod(argv[argn], &end);
+				if (end == argv[argn] || *end != '\0' || ratio < 1.) {
+					error("Argument is not a valid growth ratio");
+					return false;
+				}
+				GarbageCollector::instance().set_collection_growth(ratio);
+			}
+			else {
+				error("Argument expected for the --gc-growth option");
+				return false;
+			}
+		}
+		else if (!strcmp(argv[argn], "--gc-slice")) {
+			if (++argn < argc) {
+				char *end = nullptr;
+				const unsigned long long budget = strtoull(argv[argn], &end, 10);
+				if (end == argv[argn] || *end != '\0') {
+					error("Argument is not a valid duration");
+					return false;
+				}
+				GarbageCollector::instance().set_collection_slice(std::chrono::microseconds(budget));
+			}
+			else {
+				error("Argument expected for the --gc-slice option");
+				return false;
+			}
+		}
+		else if (!strcmp(argv[argn], "--gc-threads")) {
+			if (++argn < argc) {
+				char *end = nullptr;
+				const unsigned long long count = strtoull(argv[argn], &end, 10);
+				if (end == argv[argn] || *end != '\0' || count < 1) {
+					error("Argument is not a valid thread count");
+					return false;
+				}
+				GarbageCollector::instance().set_collection_threads(static_cast<size_t>(count));
+			}
+			else {
+				error("Argument expected for the --gc-threads option");
+				return false;
+			}
+		}
+		else if (!strcmp(argv[argn], "--gc-reclaim-delay")) {
+			if (++argn < argc) {
+				char *end = nullptr;
+				const unsigned long long count = strtoull(argv[argn], &end, 10);
+				if (end == argv[argn] || *end != '\0') {
+					error("Argument is not a valid collection count");
+					return false;
+				}
+				GarbageCollector::instance().set_reclaim_delay(static_cast<size_t>(count));
+			}
+			else {
+				error("Argument expected for the --gc-reclaim-delay option");
+				return false;
+			}
+		}
 		else if (!strcmp(argv[argn], "--exec")) {
 			if (++argn < argc) {
 				if (Process *thread = Process::from_buffer(m_ast, argv[argn])) {
@@ -556,11 +656,20 @@ void Scheduler::print_help() {
 	mint::print(stdout, "  --help            : Print this help message and exit\n");
 	mint::print(stdout, "  --version         : Print mint version and exit\n");
 	mint::print(stdout, "  --exec 'command'  : Execute a command line\n");
+	mint::print(stdout, "  --gc-threshold N  : Collect reference cycles once N objects are allocated (0 to disable)\n");
+	mint::print(stdout, "  --gc-growth R     : Allow the heap to grow by a ratio R of the live objects between collections\n");
+	mint::print(stdout, "  --gc-slice US     : Pause the script at most US microseconds per full collection step (0 to disable)\n");
+	mint::print(stdout, "  --gc-threads N    : Mark and sweep full collections with N threads\n");
+	mint::print(stdout, "  --gc-reclaim-delay N : Release the memory left empty by N + 1 successive full collections\n");
 }
 
 bool Scheduler::schedule(Process *thread, RunOptions options) {
 
 	g_current_process.emplace_back(thread);
+
+	// a nested process is started by a native function whose locals are not
+	// visible to the garbage collector
+	NestedProcessGuard guard(g_current_process.size() > 1);
 	thread->setup();
 
 	if (DebugInterface *handle = m_debug_interface) {
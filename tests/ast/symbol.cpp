@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <mint/ast/symbol.h>
+#include "mint/ast/abstractsyntaxtree.h"
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mint;
+
+TEST(symbol, intern) {
+
+	const std::string name = "interned";
+	Symbol first(name);
+	Symbol second("interned");
+	Symbol other("other");
+
+	EXPECT_EQ(first, second);
+	EXPECT_NE(first, other);
+	EXPECT_EQ(first.hash(), second.hash());
+	EXPECT_EQ(first.hash(), std::hash<Symbol> {}(second));
+	EXPECT_EQ("interned", first.str());
+	EXPECT_EQ(builtin_symbols::NEW_METHOD, Symbol("new"));
+
+	Symbol copy = first;
+	EXPECT_EQ(first, copy);
+	copy = other;
+	EXPECT_EQ(other, copy);
+	EXPECT_EQ("other", copy.str());
+}
+
+TEST(symbol, release) {
+
+	const size_t count = Symbol::interned_count();
+
+	{
+		Symbol runtime("runtime_name");
+		Symbol copy = runtime;
+		EXPECT_EQ(count + 1, Symbol::interned_count());
+		Symbol moved = std::move(copy);
+		EXPECT_EQ(runtime, moved);
+		EXPECT_EQ(count + 1, Symbol::interned_count());
+	}
+
+	// the name is removed from the table with its last symbol
+	EXPECT_EQ(count, Symbol::interned_count());
+
+	// the builtin names stay in the table
+	EXPECT_EQ(builtin_symbols::NEW_METHOD, Symbol("new"));
+	EXPECT_EQ(count, Symbol::interned_count());
+}
+
+TEST(symbol, threads) {
+
+	const size_t count = Symbol::interned_count();
+	std::vector<Symbol> symbols(4, Symbol(""));
+	std::vector<std::thread> threads;
+
+	for (size_t i = 0; i < symbols.size(); ++i) {
+		threads.emplace_back([&symbol = symbols[i]] {
+			for (int j = 0; j < 1000; ++j) {
+				symbol = Symbol("thread_" + std::to_string(j));
+			}
+		});
+	}
+
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+
+	for (const Symbol &symbol : symbols) {
+		EXPECT_EQ(Symbol("thread_999"), symbol);
+	}
+
+	// only the names still used by the symbols are left in the table
+	symbols.clear();
+	EXPECT_EQ(count, Symbol::interned_count());
+}
+
+TEST(symbol, module) {
+
+	AbstractSyntaxTree ast;
+	Module *module = ast.create_module(Module::READY).module;
+	Symbol *symbol = module->make_symbol("symbol");
+
+	EXPECT_EQ(symbol, module->make_symbol("symbol"));
+	EXPECT_NE(symbol, module->make_symbol("other"));
+	EXPECT_EQ(Symbol("symbol"), *symbol);
+}
@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
 #include <mint/memory/functiontool.h>
 #include "mint/memory/builtin/string.h"
+#include "mint/memory/garbagecollector.h"
+#include "mint/scheduler/processor.h"
 #include "mint/ast/abstractsyntaxtree.h"
+#include "mint/ast/cursor.h"
+
+#include <cerrno>
+#include <thread>
 
 using namespace mint;
 
@@ -13,6 +19,39 @@ TEST(functiontool, return_value) {
 	/// \todo
 }
 
+TEST(functiontool, blocking_region) {
+
+	AbstractSyntaxTree ast;
+	std::unique_ptr<Cursor> cursor(ast.create_cursor());
+
+	lock_processor();
+
+	{
+		FunctionHelper helper(cursor.get(), 0);
+		WeakReference ref = create_string("test");
+		auto *data = ref.data<String>();
+		std::string value;
+
+		{
+			auto region = helper.blocking_region({ref});
+			std::thread thread([&ref, &value, data] {
+				lock_processor();
+				ref = WeakReference();
+				GarbageCollector::instance().collect();
+				value = data->str;
+				unlock_processor();
+			});
+			thread.join();
+			errno = EAGAIN;
+		}
+
+		EXPECT_EQ("test", value);
+		EXPECT_EQ(EAGAIN, errno);
+	}
+
+	unlock_processor();
+}
+
 TEST(functiontool, create_number) {
 
 	WeakReference ref = create_number(7357);
@@ -1,2 +1,387 @@
 #include <gtest/gtest.h>
 #include <mint/memory/garbagecollector.h>
+#include <mint/memory/reference.h>
+#include <mint/memory/object.h>
+#include "mint/memory/builtin/array.h"
+#include "mint/memory/functiontool.h"
+#include "mint/ast/abstractsyntaxtree.h"
+#include "mint/ast/cursor.h"
+#include "mint/scheduler/processor.h"
+
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace mint;
+
+namespace {
+
+/*
+ * Finishes the cycle left in progress by a test and restores the settings of
+ * the collector, even when the test stops on a failed assertion.
+ */
+class CollectorState {
+public:
+	CollectorState() :
+		m_garbage_collector(GarbageCollector::instance()),
+		m_threshold(m_garbage_collector.collection_threshold()),
+		m_growth(m_garbage_collector.collection_growth()),
+		m_slice(m_garbage_collector.collection_slice()),
+		m_threads(m_garbage_collector.collection_threads()),
+		m_reclaim_delay(m_garbage_collector.reclaim_delay()) {}
+
+	CollectorState(CollectorState &&) = delete;
+	CollectorState(const CollectorState &) = delete;
+
+	~CollectorState() {
+		if (m_garbage_collector.collection_in_progress()) {
+			m_garbage_collector.collect();
+		}
+		m_garbage_collector.set_collection_threshold(m_threshold);
+		m_garbage_collector.set_collection_growth(m_growth);
+		m_garbage_collector.set_collection_slice(m_slice);
+		m_garbage_collector.set_collection_threads(m_threads);
+		m_garbage_collector.set_reclaim_delay(m_reclaim_delay);
+	}
+
+	CollectorState &operator=(CollectorState &&) = delete;
+	CollectorState &operator=(const CollectorState &) = delete;
+
+private:
+	GarbageCollector &m_garbage_collector;
+	size_t m_threshold;
+	double m_growth;
+	std::chrono::microseconds m_slice;
+	size_t m_threads;
+	size_t m_reclaim_delay;
+};
+
+/*
+ * Holds the processor lock until the end of the scope.
+ */
+struct ProcessorLock {
+	ProcessorLock() {
+		lock_processor();
+	}
+
+	ProcessorLock(ProcessorLock &&) = delete;
+	ProcessorLock(const ProcessorLock &) = delete;
+
+	~ProcessorLock() {
+		unlock_processor();
+	}
+
+	ProcessorLock &operator=(ProcessorLock &&) = delete;
+	ProcessorLock &operator=(const ProcessorLock &) = delete;
+};
+
+}
+
+TEST(garbagecollector, collection_threshold) {
+
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+	CollectorState state;
+
+	StrongReference first(Reference::DEFAULT, GarbageCollector::instance().alloc<Number>(1.));
+
+	garbage_collector.set_collection_threshold(0);
+	EXPECT_FALSE(garbage_collector.collection_requested());
+	EXPECT_FALSE(garbage_collector.collect_if_requested());
+
+	std::vector<StrongReference> references;
+	garbage_collector.set_collection_threshold(1);
+	garbage_collector.set_collection_growth(2.);
+	while (!garbage_collector.collection_requested()) {
+		references.emplace_back(Reference::DEFAULT, GarbageCollector::instance().alloc<Number>(2.));
+	}
+	EXPECT_TRUE(garbage_collector.collect_if_requested());
+	EXPECT_FALSE(garbage_collector.collection_requested());
+	EXPECT_EQ(1., first.data<Number>()->value);
+
+	garbage_collector.suspend_automatic_collection();
+	while (!garbage_collector.collection_requested()) {
+		references.emplace_back(Reference::DEFAULT, GarbageCollector::instance().alloc<Number>(2.));
+	}
+	const bool collected = garbage_collector.collect_if_requested();
+	garbage_collector.resume_automatic_collection();
+	EXPECT_FALSE(collected);
+	EXPECT_TRUE(garbage_collector.collect_if_requested());
+	EXPECT_FALSE(garbage_collector.collection_requested());
+}
+
+TEST(garbagecollector, collect_young) {
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+
+	// promote an array to the old generation
+	StrongReference old_array = create_array();
+	garbage_collector.collect_young();
+
+	{
+		WeakReference first = create_array();
+		WeakReference second = create_array();
+		array_append(first.data<Array>(), WeakReference::share(second));
+		array_append(second.data<Array>(), WeakReference::share(first));
+		array_append(old_array.data<Array>(), create_array({create_number(1.)}));
+	}
+
+	// the cycle is only referenced from the young generation
+	EXPECT_EQ(2, garbage_collector.collect_young());
+
+	// the item is referenced from the old generation
+	ASSERT_EQ(1, old_array.data<Array>()->values.size());
+	const Reference &item = old_array.data<Array>()->values.front();
+	ASSERT_EQ(1, item.data<Array>()->values.size());
+	EXPECT_EQ(1., item.data<Array>()->values.front().data<Number>()->value);
+}
+
+TEST(garbagecollector, native_references) {
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+	CollectorState state;
+	garbage_collector.set_reclaim_delay(0);
+
+	// the members of the builtin class are created on the first use
+	create_array();
+	garbage_collector.collect();
+
+	// cycles filling whole pages, only referenced from the native frame
+	std::vector<WeakReference> references;
+	for (int i = 0; i < 10000; ++i) {
+		WeakReference item = create_array();
+		array_append(item.data<Array>(), WeakReference::share(item));
+		references.emplace_back(std::move(item));
+	}
+
+	// the data are collected but their slots are kept until the references are released
+	EXPECT_EQ(10000, garbage_collector.collect());
+	const size_t heap_pages = garbage_collector.statistics().heap_pages;
+	EXPECT_EQ(0, garbage_collector.collect());
+	EXPECT_EQ(heap_pages, garbage_collector.statistics().heap_pages);
+
+	references.clear();
+	EXPECT_EQ(0, garbage_collector.collect());
+	EXPECT_GT(heap_pages, garbage_collector.statistics().heap_pages);
+}
+
+TEST(garbagecollector, blocking_region) {
+
+	AbstractSyntaxTree ast;
+	std::unique_ptr<Cursor> cursor(ast.create_cursor());
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+	ProcessorLock lock;
+
+	garbage_collector.collect();
+
+	{
+		FunctionHelper helper(cursor.get(), 0);
+
+		// an old cycle only referenced from the native frame
+		WeakReference first = create_array();
+		WeakReference second = create_array();
+		array_append(first.data<Array>(), WeakReference::share(second));
+		array_append(second.data<Array>(), WeakReference::share(first));
+
+		// an old cycle that is no longer referenced
+		{
+			WeakReference garbage = create_array();
+			array_append(garbage.data<Array>(), create_array({WeakReference::share(garbage)}));
+			garbage_collector.collect_young();
+		}
+
+		{
+			WeakReference garbage = create_array();
+			array_append(garbage.data<Array>(), WeakReference::share(garbage));
+		}
+
+		size_t collected = 0;
+
+		{
+			auto region = helper.blocking_region();
+			std::thread thread([&garbage_collector, &collected] {
+				lock_processor();
+				collected = garbage_collector.collect();
+				unlock_processor();
+			});
+			thread.join();
+		}
+
+		// the data referenced from the native frame are kept, any other garbage is collected
+		EXPECT_EQ(3, collected);
+		ASSERT_EQ(1, first.data<Array>()->values.size());
+		EXPECT_EQ(second.data(), first.data<Array>()->values.front().data());
+		ASSERT_EQ(1, second.data<Array>()->values.size());
+		EXPECT_EQ(first.data(), second.data<Array>()->values.front().data());
+	}
+
+	EXPECT_EQ(2, garbage_collector.collect());
+}
+
+TEST(garbagecollector, collect_incrementally) {
+
+	using namespace std::chrono_literals;
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+	CollectorState state;
+
+	StrongReference old_array = create_array();
+	for (int i = 0; i < 1000; ++i) {
+		array_append(old_array.data<Array>(), create_array({create_array({create_number(i)})}));
+	}
+	garbage_collector.collect();
+
+	EXPECT_FALSE(garbage_collector.collect_incrementally(0us));
+	ASSERT_TRUE(garbage_collector.collection_in_progress());
+
+	// the first item is traced last, its content is moved to a root that was not marked
+	Array *item = old_array.data<Array>()->values.front().data<Array>();
+	StrongReference moved(WeakReference::share(item->values.front()));
+	item->values.clear();
+
+	size_t steps = 1;
+	while (!garbage_collector.collect_incrementally(0us)) {
+		++steps;
+	}
+	EXPECT_LT(1, steps);
+	EXPECT_FALSE(garbage_collector.collection_in_progress());
+
+	for (int i = 0; i < 1000; ++i) {
+		create_array({create_number(-1)});
+	}
+
+	ASSERT_EQ(1, moved.data<Array>()->values.size());
+	EXPECT_EQ(0., moved.data<Array>()->values.front().data<Number>()->value);
+}
+
+TEST(garbagecollector, deep_graph) {
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+
+	// the depth of the list exceeds the native stack used by a recursive traversal
+	std::optional<StrongReference> list(create_array());
+	Array *node = list->data<Array>();
+	for (int i = 0; i < 1000000; ++i) {
+		WeakReference next = create_array();
+		Array *next_node = next.data<Array>();
+		array_append(node, std::move(next));
+		node = next_node;
+	}
+
+	EXPECT_EQ(0, garbage_collector.collect());
+	list.reset();
+	EXPECT_EQ(0, garbage_collector.collect());
+}
+
+TEST(garbagecollector, collect_in_parallel) {
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+	CollectorState state;
+	garbage_collector.set_collection_threads(4);
+
+	StrongReference graph = create_array();
+	for (int i = 0; i < 10000; ++i) {
+		WeakReference item = create_array({create_number(i)});
+		array_append(item.data<Array>(), WeakReference::share(item));
+		array_append(graph.data<Array>(), std::move(item));
+	}
+
+	EXPECT_EQ(0, garbage_collector.collect());
+	for (int i = 0; i < 10000; ++i) {
+		const Reference &item = graph.data<Array>()->values[i];
+		ASSERT_EQ(2, item.data<Array>()->values.size());
+		EXPECT_EQ(i, item.data<Array>()->values.front().data<Number>()->value);
+	}
+
+	// each item refers to itself, the cycles are collected with their numbers
+	graph.data<Array>()->values.clear();
+	EXPECT_EQ(20000, garbage_collector.collect());
+}
+
+TEST(garbagecollector, forked_process) {
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+	CollectorState state;
+	garbage_collector.set_collection_threads(4);
+
+	// the heap is large enough to start the collector threads
+	StrongReference graph = create_array();
+	for (int i = 0; i < 10000; ++i) {
+		array_append(graph.data<Array>(), create_array({create_number(i)}));
+	}
+	garbage_collector.collect();
+
+	// the child replaces the pool without waiting for the threads of the parent
+	EXPECT_EXIT(
+		{
+			garbage_collector.set_collection_threads(2);
+			garbage_collector.collect();
+			std::_Exit(EXIT_SUCCESS);
+		},
+		::testing::ExitedWithCode(EXIT_SUCCESS), "");
+}
+
+TEST(garbagecollector, statistics) {
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+
+	StrongReference kept = create_array({create_number(1.)});
+	for (int i = 0; i < 10; ++i) {
+		WeakReference item = create_array();
+		array_append(item.data<Array>(), WeakReference::share(item));
+	}
+
+	const GarbageCollectorStatistics before = garbage_collector.statistics();
+	EXPECT_EQ(10, garbage_collector.collect());
+	const GarbageCollectorStatistics after = garbage_collector.statistics();
+
+	EXPECT_EQ(before.full_collections + 1, after.full_collections);
+	EXPECT_LT(before.pauses, after.pauses);
+	EXPECT_LE(after.last_pause_time, after.max_pause_time);
+	EXPECT_LE(after.max_pause_time, after.pause_time);
+
+	const auto &arrays_before = before.metatypes[Class::ARRAY];
+	const auto &arrays_after = after.metatypes[Class::ARRAY];
+	EXPECT_EQ(arrays_before.swept_objects + 10, arrays_after.swept_objects);
+	EXPECT_LE(arrays_before.swept_bytes + 10 * sizeof(Array), arrays_after.swept_bytes);
+	EXPECT_LT(arrays_before.marked_objects, arrays_after.marked_objects);
+	EXPECT_EQ(arrays_before.live_objects - 10, arrays_after.live_objects);
+	EXPECT_EQ(before.formats[Data::FMT_OBJECT].swept_objects + 10, after.formats[Data::FMT_OBJECT].swept_objects);
+	EXPECT_LE(1, after.formats[Data::FMT_NUMBER].live_objects);
+
+	EXPECT_LE(1, after.roots);
+	EXPECT_LE(1, after.heap_pages);
+	EXPECT_EQ(after.heap_pages * HeapPage::SIZE, after.heap_bytes);
+	EXPECT_LE(2, after.reference_infos);
+	EXPECT_LE(1, after.reference_info_chunks);
+}
+
+TEST(garbagecollector, waiting_calls) {
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+	std::unique_ptr<Cursor> cursor(ast.create_cursor());
+
+	// the members of the builtin class are created on the first use
+	create_array();
+	garbage_collector.collect();
+
+	// the pending calls are marked by their cursor without registering new roots
+	const size_t roots = garbage_collector.statistics().roots;
+	cursor->waiting_calls().emplace(create_array());
+	cursor->waiting_calls().emplace(create_array());
+	EXPECT_EQ(roots, garbage_collector.statistics().roots);
+	EXPECT_EQ(0, garbage_collector.collect());
+
+	cursor->waiting_calls().pop();
+	EXPECT_EQ(0, garbage_collector.collect());
+	EXPECT_EQ(Class::ARRAY, cursor->waiting_calls().top().function().data<Object>()->metadata->metatype());
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <mint/memory/heap.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace mint;
+
+TEST(heap, allocate) {
+
+	Heap &heap = Heap::instance();
+
+	void *first = heap.allocate(24);
+	void *second = heap.allocate(24);
+	HeapPage *page = HeapPage::of(first);
+
+	EXPECT_EQ(page, HeapPage::of(second));
+	EXPECT_EQ(32, page->slot_size);
+	EXPECT_EQ(first, page->address(HeapPage::granule(first)));
+	EXPECT_EQ(2, HeapPage::granule(second) - HeapPage::granule(first));
+
+	heap.deallocate(second);
+	EXPECT_EQ(second, heap.allocate(24));
+
+	heap.deallocate(first);
+	heap.deallocate(second);
+}
+
+TEST(heap, bitmap) {
+
+	HeapPage::Bitmap bitmap;
+
+	bitmap.set(0);
+	bitmap.set(65);
+	EXPECT_TRUE(bitmap.test(0));
+	EXPECT_FALSE(bitmap.test(1));
+	EXPECT_TRUE(bitmap.test(65));
+	EXPECT_EQ(1, HeapPage::Bitmap::lowest_bit(bitmap.words[1]));
+
+	bitmap.reset(65);
+	EXPECT_FALSE(bitmap.test(65));
+
+	bitmap.clear();
+	EXPECT_FALSE(bitmap.test(0));
+}
+
+TEST(heap, reclaim) {
+
+	Heap &heap = Heap::instance();
+	const size_t slot_count = 2 * HeapPage::SIZE / Heap::MAX_SLOT_SIZE;
+
+	std::vector<void *> slots;
+	for (size_t i = 0; i < slot_count; ++i) {
+		slots.push_back(heap.allocate(Heap::MAX_SLOT_SIZE));
+	}
+
+	// the page of the last slot only contains slots of this test
+	HeapPage *page = HeapPage::of(slots.back());
+	const auto contains = [&heap](HeapPage *page) {
+		return std::find(heap.pages().begin(), heap.pages().end(), page) != heap.pages().end();
+	};
+
+	heap.reclaim(1);
+	EXPECT_TRUE(contains(page));
+
+	for (void *slot : slots) {
+		heap.deallocate(slot);
+	}
+	EXPECT_EQ(0, page->used);
+
+	heap.reclaim(1);
+	EXPECT_TRUE(contains(page));
+
+	EXPECT_LE(HeapPage::SIZE, heap.reclaim(1));
+	EXPECT_FALSE(contains(page));
+
+	void *slot = heap.allocate(Heap::MAX_SLOT_SIZE);
+	EXPECT_TRUE(contains(HeapPage::of(slot)));
+	heap.deallocate(slot);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <mint/memory/heapprofiler.h>
+#include <mint/memory/garbagecollector.h>
+#include <mint/memory/reference.h>
+#include "mint/memory/functiontool.h"
+#include "mint/ast/abstractsyntaxtree.h"
+
+#include <string>
+
+using namespace mint;
+
+static std::string write_profile(const HeapProfiler &profiler, HeapProfiler::Profile profile) {
+
+	FILE *stream = tmpfile();
+	profiler.write(stream, profile);
+
+	std::string output;
+	rewind(stream);
+	for (int c = fgetc(stream); c != EOF; c = fgetc(stream)) {
+		output += static_cast<char>(c);
+	}
+	fclose(stream);
+	return output;
+}
+
+TEST(heapprofiler, sample) {
+
+	HeapProfiler profiler(1);
+	const Data *first = reinterpret_cast<const Data *>(0x10);
+	const Data *second = reinterpret_cast<const Data *>(0x20);
+
+	EXPECT_EQ(1, profiler.sampling_interval());
+	EXPECT_LE(1, profiler.next_sample());
+
+	profiler.sample(first, 64);
+	profiler.sample(second, 32);
+	EXPECT_EQ("[native] 2\n", write_profile(profiler, HeapProfiler::LIVE_OBJECTS));
+	EXPECT_EQ("[native] 96\n", write_profile(profiler, HeapProfiler::LIVE_BYTES));
+
+	profiler.release(first);
+	profiler.release(first);
+	EXPECT_EQ("[native] 1\n", write_profile(profiler, HeapProfiler::LIVE_OBJECTS));
+	EXPECT_EQ("[native] 32\n", write_profile(profiler, HeapProfiler::LIVE_BYTES));
+	EXPECT_EQ("[native] 2\n", write_profile(profiler, HeapProfiler::ALLOCATED_OBJECTS));
+	EXPECT_EQ("[native] 96\n", write_profile(profiler, HeapProfiler::ALLOCATED_BYTES));
+
+	profiler.release(second);
+	EXPECT_EQ("", write_profile(profiler, HeapProfiler::LIVE_OBJECTS));
+}
+
+TEST(heapprofiler, garbage_collector) {
+
+	AbstractSyntaxTree ast;
+	GarbageCollector &garbage_collector = GarbageCollector::instance();
+
+	// the members of the builtin class are created on the first use
+	create_array();
+
+	garbage_collector.start_heap_profiler(1);
+	ASSERT_NE(nullptr, garbage_collector.heap_profiler());
+
+	{
+		WeakReference array = create_array();
+		EXPECT_EQ("[native] 1\n", write_profile(*garbage_collector.heap_profiler(), HeapProfiler::LIVE_OBJECTS));
+	}
+
+	EXPECT_EQ("", write_profile(*garbage_collector.heap_profiler(), HeapProfiler::LIVE_OBJECTS));
+	EXPECT_EQ("[native] 1\n", write_profile(*garbage_collector.heap_profiler(), HeapProfiler::ALLOCATED_OBJECTS));
+
+	garbage_collector.stop_heap_profiler();
+	EXPECT_EQ(nullptr, garbage_collector.heap_profiler());
+}
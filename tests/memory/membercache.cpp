@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <mint/memory/membercache.h>
+#include "mint/ast/abstractsyntaxtree.h"
+#include "mint/ast/cursor.h"
+#include "mint/memory/classtool.h"
+#include "mint/memory/functiontool.h"
+#include "mint/memory/memorytool.h"
+#include "mint/memory/garbagecollector.h"
+
+using namespace mint;
+
+TEST(membercache, find) {
+
+	AbstractSyntaxTree ast;
+	Cursor *cursor = ast.create_cursor();
+	MemberCache cache;
+
+	Class *first_class = create_class("__first_class__", {{Symbol("value"), create_number(1)}});
+	ASSERT_NE(nullptr, first_class);
+
+	Class *second_class = create_class("__second_class__", {{Symbol("value"), create_number(2)}});
+	ASSERT_NE(nullptr, second_class);
+
+	WeakReference first(Reference::DEFAULT, GarbageCollector::instance().alloc<Object>(first_class));
+	first.data<Object>()->construct();
+
+	WeakReference second(Reference::DEFAULT, GarbageCollector::instance().alloc<Object>(second_class));
+	second.data<Object>()->construct();
+
+	EXPECT_EQ(nullptr, cache.find(cursor, first.data<Object>()));
+
+	Class::MemberInfo *info = first_class->members().find(Symbol("value"))->second;
+	cache.insert(cursor, first.data<Object>(), info);
+	EXPECT_EQ(info, cache.find(cursor, first.data<Object>()));
+	EXPECT_EQ(nullptr, cache.find(cursor, second.data<Object>()));
+
+	MemberCache::invalidate_all();
+	EXPECT_EQ(nullptr, cache.find(cursor, first.data<Object>()));
+
+	delete cursor;
+}
+
+TEST(membercache, get_member) {
+
+	AbstractSyntaxTree ast;
+	Cursor *cursor = ast.create_cursor();
+	MemberCache cache;
+
+	std::vector<WeakReference> objects;
+
+	for (size_t i = 0; i <= MemberCache::ENTRY_COUNT; ++i) {
+		Class *test_class = create_class("__test_class_" + std::to_string(i) + "__",
+										 {{Symbol("value"), create_number(static_cast<double>(i))}});
+		ASSERT_NE(nullptr, test_class);
+		WeakReference object(Reference::DEFAULT, GarbageCollector::instance().alloc<Object>(test_class));
+		object.data<Object>()->construct();
+		objects.emplace_back(std::move(object));
+	}
+
+	for (size_t pass = 0; pass < 2; ++pass) {
+		for (size_t i = 0; i < MemberCache::ENTRY_COUNT; ++i) {
+			WeakReference result = get_member(cursor, objects[i], Symbol("value"), &cache);
+			ASSERT_EQ(Data::FMT_NUMBER, result.data()->format);
+			EXPECT_EQ(static_cast<double>(i), result.data<Number>()->value);
+		}
+	}
+
+	EXPECT_FALSE(cache.is_megamorphic());
+
+	WeakReference result = get_member(cursor, objects.back(), Symbol("value"), &cache);
+	ASSERT_EQ(Data::FMT_NUMBER, result.data()->format);
+	EXPECT_EQ(static_cast<double>(MemberCache::ENTRY_COUNT), result.data<Number>()->value);
+	EXPECT_TRUE(cache.is_megamorphic());
+
+	for (size_t i = 0; i < objects.size(); ++i) {
+		WeakReference result = get_member(cursor, objects[i], Symbol("value"), &cache);
+		ASSERT_EQ(Data::FMT_NUMBER, result.data()->format);
+		EXPECT_EQ(static_cast<double>(i), result.data<Number>()->value);
+	}
+
+	MemberCache::invalidate_all();
+	EXPECT_FALSE(cache.is_megamorphic());
+
+	result = get_member(cursor, objects.front(), Symbol("value"), &cache);
+	ASSERT_EQ(Data::FMT_NUMBER, result.data()->format);
+	EXPECT_EQ(0., result.data<Number>()->value);
+	EXPECT_EQ(objects.front().data<Object>()->metadata->members().find(Symbol("value"))->second,
+			  cache.find(cursor, objects.front().data<Object>()));
+
+	delete cursor;
+}
@@ -141,7 +141,44 @@ TEST(memorytool, init_parameter) {
 }
 
 TEST(memorytool, find_function_signature) {
-	/// \todo
+
+	AbstractSyntaxTree ast;
+	Cursor *cursor = ast.create_cursor();
+
+	Module::Handle unary_handle = {};
+	Module::Handle variadic_handle = {};
+	Module::Handle ternary_handle = {};
+
+	Function::Mapping mapping;
+	mapping.emplace(1, Function::Signature(&unary_handle));
+	mapping.emplace(~2, Function::Signature(&variadic_handle));
+
+	EXPECT_EQ(mapping.end(), find_function_signature(cursor, mapping, 0));
+
+	for (int i = 0; i < 2; ++i) {
+		auto it = find_function_signature(cursor, mapping, 1);
+		ASSERT_NE(mapping.end(), it);
+		EXPECT_EQ(&unary_handle, it->second.handle);
+	}
+
+	cursor->stack().emplace_back(create_number(1));
+	cursor->stack().emplace_back(create_number(2));
+	cursor->stack().emplace_back(create_number(3));
+
+	auto it = find_function_signature(cursor, mapping, 3);
+	ASSERT_NE(mapping.end(), it);
+	EXPECT_EQ(&variadic_handle, it->second.handle);
+	ASSERT_EQ(3, cursor->stack().size());
+	EXPECT_EQ(Data::FMT_OBJECT, cursor->stack().back().data()->format);
+	EXPECT_EQ(Class::ITERATOR, cursor->stack().back().data<Object>()->metadata->metatype());
+
+	mapping.emplace(3, Function::Signature(&ternary_handle));
+
+	it = find_function_signature(cursor, mapping, 3);
+	ASSERT_NE(mapping.end(), it);
+	EXPECT_EQ(&ternary_handle, it->second.handle);
+
+	delete cursor;
 }
 
 TEST(memorytool, yield) {
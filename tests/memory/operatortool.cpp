@@ -39,3 +39,68 @@ TEST(operatortool, call_overload) {
 	ASSERT_DEATH(call_overload(cursor.get(), "+", 1), "invalid use of class 'string' in an operation");
 	cursor->stack().clear();
 }
+
+TEST(operatortool, add_operator) {
+
+	AbstractSyntaxTree ast;
+	std::unique_ptr<Cursor> cursor(ast.create_cursor());
+
+	WeakReference lvalue(Reference::DEFAULT, GarbageCollector::instance().alloc<Number>(40));
+	cursor->stack().emplace_back(WeakReference::share(lvalue));
+	cursor->stack().emplace_back(WeakReference::create<Number>(2));
+	Data *rvalue = cursor->stack().back().data();
+	add_operator(cursor.get());
+
+	ASSERT_EQ(1u, cursor->stack().size());
+	ASSERT_EQ(Data::FMT_NUMBER, cursor->stack().back().data()->format);
+	EXPECT_EQ(42, cursor->stack().back().data<Number>()->value);
+	EXPECT_EQ(rvalue, cursor->stack().back().data());
+	EXPECT_EQ(40, lvalue.data<Number>()->value);
+	cursor->stack().clear();
+
+	cursor->stack().emplace_back(WeakReference::share(lvalue));
+	cursor->stack().emplace_back(WeakReference::share(lvalue));
+	add_operator(cursor.get());
+
+	ASSERT_EQ(1u, cursor->stack().size());
+	ASSERT_EQ(Data::FMT_NUMBER, cursor->stack().back().data()->format);
+	EXPECT_EQ(80, cursor->stack().back().data<Number>()->value);
+	EXPECT_NE(lvalue.data(), cursor->stack().back().data());
+	EXPECT_EQ(40, lvalue.data<Number>()->value);
+	cursor->stack().clear();
+}
+
+TEST(operatortool, lt_operator) {
+
+	AbstractSyntaxTree ast;
+	std::unique_ptr<Cursor> cursor(ast.create_cursor());
+
+	cursor->stack().emplace_back(WeakReference::create<Number>(1));
+	cursor->stack().emplace_back(WeakReference::create<Number>(2));
+	lt_operator(cursor.get());
+
+	ASSERT_EQ(1u, cursor->stack().size());
+	ASSERT_EQ(Data::FMT_BOOLEAN, cursor->stack().back().data()->format);
+	EXPECT_TRUE(cursor->stack().back().data<Boolean>()->value);
+	EXPECT_EQ(Reference::CONST_ADDRESS | Reference::CONST_VALUE, cursor->stack().back().flags());
+	Data *result = cursor->stack().back().data();
+	cursor->stack().clear();
+
+	cursor->stack().emplace_back(WeakReference::create<Number>(3));
+	cursor->stack().emplace_back(WeakReference::create<Number>(4));
+	lt_operator(cursor.get());
+
+	ASSERT_EQ(1u, cursor->stack().size());
+	EXPECT_EQ(result, cursor->stack().back().data());
+	cursor->stack().clear();
+
+	cursor->stack().emplace_back(WeakReference::create<Number>(2));
+	cursor->stack().emplace_back(WeakReference::create<Number>(1));
+	lt_operator(cursor.get());
+
+	ASSERT_EQ(1u, cursor->stack().size());
+	ASSERT_EQ(Data::FMT_BOOLEAN, cursor->stack().back().data()->format);
+	EXPECT_FALSE(cursor->stack().back().data<Boolean>()->value);
+	EXPECT_NE(result, cursor->stack().back().data());
+	cursor->stack().clear();
+}
@@ -1,2 +1,29 @@
 #include <gtest/gtest.h>
 #include <mint/memory/reference.h>
+#include <mint/memory/functiontool.h>
+#include <mint/ast/abstractsyntaxtree.h>
+
+using namespace mint;
+
+TEST(reference, layout) {
+	EXPECT_EQ(sizeof(void *), sizeof(WeakReference));
+	EXPECT_GE(2 * sizeof(std::uint64_t), sizeof(Reference::Info));
+}
+
+TEST(reference, share) {
+
+	AbstractSyntaxTree ast;
+
+	WeakReference reference = create_number(1);
+	WeakReference shared = WeakReference::share(reference);
+	EXPECT_EQ(reference.info(), shared.info());
+	EXPECT_EQ(2, reference.info()->refcount);
+
+	shared.move_data(create_number(2));
+	EXPECT_EQ(2, reference.data<Number>()->value);
+
+	WeakReference copy = WeakReference::copy(reference);
+	EXPECT_NE(reference.info(), copy.info());
+	EXPECT_EQ(reference.data(), copy.data());
+	EXPECT_EQ(reference.flags(), copy.flags());
+}
@@ -1,2 +1,44 @@
 #include <gtest/gtest.h>
 #include <mint/memory/symboltable.h>
+#include <mint/memory/functiontool.h>
+#include <mint/ast/abstractsyntaxtree.h>
+
+using namespace mint;
+
+TEST(symboltable, stacked_fast) {
+
+	AbstractSyntaxTree ast;
+	SymbolTable symbols;
+	const Symbol symbol("a");
+
+	alignas(SymbolTable::fast_type) byte_t frame[2 * sizeof(SymbolTable::fast_type)];
+	symbols.reserve_fast(reinterpret_cast<SymbolTable::fast_type *>(frame), 2);
+
+	symbols.setup_fast(symbol, 0).move_data(create_number(42));
+	ASSERT_TRUE(symbols.contains(symbol));
+	EXPECT_EQ(symbols[symbol].data(), symbols.get_fast(symbol, 0).data());
+	EXPECT_EQ(symbols[symbol].info(), symbols.get_fast(symbol, 0).info());
+
+	EXPECT_EQ(1, symbols.erase_fast(symbol, 0));
+	EXPECT_FALSE(symbols.contains(symbol));
+}
+
+TEST(symboltable, fast) {
+
+	AbstractSyntaxTree ast;
+	SymbolTable symbols;
+	const Symbol symbol("a");
+
+	symbols.reserve_fast(2);
+
+	// the symbol is created on the first access
+	EXPECT_EQ(Data::FMT_NONE, symbols.get_fast(symbol, 1).data()->format);
+	EXPECT_TRUE(symbols.contains(symbol));
+
+	symbols.setup_fast(symbol, 1).move_data(create_number(42));
+	ASSERT_TRUE(symbols.contains(symbol));
+	EXPECT_EQ(symbols[symbol].info(), symbols.get_fast(symbol, 1).info());
+
+	symbols.clear();
+	EXPECT_FALSE(symbols.contains(symbol));
+}
@@ -1,2 +1,322 @@
 #include <gtest/gtest.h>
 #include <mint/scheduler/processor.h>
+#include "mint/scheduler/scheduler.h"
+#include "mint/scheduler/process.h"
+#include "mint/ast/abstractsyntaxtree.h"
+#include "mint/memory/functiontool.h"
+#include "mint/memory/classtool.h"
+#include "mint/memory/casttool.h"
+#include "mint/memory/reference.h"
+#include "mint/memory/class.h"
+#include "mint/memory/data.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(processor, superinstruction_arithmetic) {
+
+	mint::Scheduler scheduler(0, nullptr);
+	mint::AbstractSyntaxTree *ast = scheduler.ast();
+	mint::Module::Info module = ast->create_module(mint::Module::READY);
+
+	mint::Process *thread = scheduler.enable_testing();
+	ASSERT_NE(nullptr, thread);
+
+	mint::WeakReference fn = mint::create_function(module, 1, R"(
+        def (n) {
+            i = 0
+            sum = 0
+            while i < n {
+                sum = sum + i
+                i = i + 1
+            }
+            while i > 0 {
+                i = i - 2
+            }
+            return sum - i
+        }
+    )");
+	ASSERT_EQ(mint::Data::FMT_FUNCTION, fn.data()->format);
+
+	mint::WeakReference result = scheduler.invoke(fn, mint::create_number(11));
+	ASSERT_EQ(mint::Data::FMT_NUMBER, result.data()->format);
+	EXPECT_EQ(56, result.data<mint::Number>()->value);
+
+	EXPECT_TRUE(scheduler.disable_testing(thread));
+}
+
+TEST(processor, superinstruction_move_number) {
+
+	mint::Scheduler scheduler(0, nullptr);
+	mint::AbstractSyntaxTree *ast = scheduler.ast();
+	mint::Module::Info module = ast->create_module(mint::Module::READY);
+
+	mint::Process *thread = scheduler.enable_testing();
+	ASSERT_NE(nullptr, thread);
+
+	mint::WeakReference fn = mint::create_function(module, 1, R"(
+        def (a) {
+            b = a
+            b = b + 1
+            c = b
+            c = c * 3
+            c = c - b
+            return [a, b, c]
+        }
+    )");
+	ASSERT_EQ(mint::Data::FMT_FUNCTION, fn.data()->format);
+
+	mint::WeakReference result = scheduler.invoke(fn, mint::create_number(1));
+	ASSERT_EQ(mint::Data::FMT_OBJECT, result.data()->format);
+	EXPECT_EQ("[1, 2, 4]", mint::to_string(result));
+
+	EXPECT_TRUE(scheduler.disable_testing(thread));
+}
+
+TEST(processor, quickening) {
+
+	mint::Scheduler scheduler(0, nullptr);
+	mint::AbstractSyntaxTree *ast = scheduler.ast();
+	mint::Module::Info module = ast->create_module(mint::Module::READY);
+
+	mint::Process *thread = scheduler.enable_testing();
+	ASSERT_NE(nullptr, thread);
+
+	mint::WeakReference fn = mint::create_function(module, 2, R"(
+        def (a, b) {
+            return [a + b, a == b, a != b, a < b]
+        }
+    )");
+	ASSERT_EQ(mint::Data::FMT_FUNCTION, fn.data()->format);
+
+	mint::WeakReference result = scheduler.invoke(fn, mint::create_number(1), mint::create_number(2));
+	EXPECT_EQ("[3, false, true, true]", mint::to_string(result));
+
+	result = scheduler.invoke(fn, mint::create_number(2), mint::create_number(2));
+	EXPECT_EQ("[4, true, false, false]", mint::to_string(result));
+
+	result = scheduler.invoke(fn, mint::create_string("a"), mint::create_string("b"));
+	EXPECT_EQ("[ab, false, true, true]", mint::to_string(result));
+
+	result = scheduler.invoke(fn, mint::create_string("b"), mint::create_string("b"));
+	EXPECT_EQ("[bb, true, false, false]", mint::to_string(result));
+
+	result = scheduler.invoke(fn, mint::create_string("a"), mint::create_number(1));
+	EXPECT_EQ("[a1, false, true, false]", mint::to_string(result));
+
+	result = scheduler.invoke(fn, mint::create_number(3), mint::create_number(1));
+	EXPECT_EQ("[4, false, true, false]", mint::to_string(result));
+
+	EXPECT_TRUE(scheduler.disable_testing(thread));
+}
+
+TEST(processor, superinstruction_compare_and_jump) {
+
+	mint::Scheduler scheduler(0, nullptr);
+	mint::AbstractSyntaxTree *ast = scheduler.ast();
+	mint::Module::Info module = ast->create_module(mint::Module::READY);
+
+	mint::Process *thread = scheduler.enable_testing();
+	ASSERT_NE(nullptr, thread);
+
+	mint::WeakReference fn = mint::create_function(module, 2, R"(
+        def (a, b) {
+            result = ''
+            if a == b {
+                result += '='
+            }
+            if a != b {
+                result += '!'
+            }
+            if a < b {
+                result += '<'
+            }
+            if a <= b {
+                result += 'l'
+            }
+            if a > b {
+                result += '>'
+            }
+            if a >= b {
+                result += 'g'
+            }
+            return result
+        }
+    )");
+	ASSERT_EQ(mint::Data::FMT_FUNCTION, fn.data()->format);
+
+	{
+		mint::WeakReference result = scheduler.invoke(fn, mint::create_number(1), mint::create_number(2));
+		ASSERT_EQ(mint::Data::FMT_OBJECT, result.data()->format);
+		EXPECT_EQ("!<l", mint::to_string(result));
+	}
+
+	{
+		mint::WeakReference result = scheduler.invoke(fn, mint::create_number(2), mint::create_number(2));
+		ASSERT_EQ(mint::Data::FMT_OBJECT, result.data()->format);
+		EXPECT_EQ("=lg", mint::to_string(result));
+	}
+
+	{
+		mint::WeakReference result = scheduler.invoke(fn, mint::create_string("b"), mint::create_string("a"));
+		ASSERT_EQ(mint::Data::FMT_OBJECT, result.data()->format);
+		EXPECT_EQ("!>g", mint::to_string(result));
+	}
+
+	EXPECT_TRUE(scheduler.disable_testing(thread));
+}
+
+TEST(processor, superinstruction_member_call) {
+
+	mint::Scheduler scheduler(0, nullptr);
+	mint::AbstractSyntaxTree *ast = scheduler.ast();
+	mint::Module::Info module = ast->create_module(mint::Module::READY);
+
+	mint::Process *thread = scheduler.enable_testing();
+	ASSERT_NE(nullptr, thread);
+
+	mint::Class *test_class = mint::create_class("__test_class__",
+												 {
+													 {mint::builtin_symbols::NEW_METHOD,
+													  mint::create_function(module, 2, R"(
+															def (self, value) {
+																self.value = value
+																return self
+															}
+														)")},
+													 {mint::builtin_symbols::LT_OPERATOR,
+													  mint::create_function(module, 2, R"(
+															def (self, other) {
+																return self.getValue() < other.value
+															}
+														)")},
+													 {"getValue", mint::create_function(module, 1, R"(
+															def (self) {
+																return self.value
+															}
+														)")},
+													 {"value", mint::WeakReference::create<mint::None>()},
+												 });
+	ASSERT_NE(nullptr, test_class);
+
+	mint::WeakReference fn = mint::create_function(module, 2, R"(
+        def (a, b) {
+            if a < b {
+                return a.getValue()
+            }
+            return b.getValue()
+        }
+    )");
+	ASSERT_EQ(mint::Data::FMT_FUNCTION, fn.data()->format);
+
+	mint::WeakReference a = scheduler.invoke(test_class, mint::create_number(3));
+	ASSERT_EQ(mint::Data::FMT_OBJECT, a.data()->format);
+
+	mint::WeakReference b = scheduler.invoke(test_class, mint::create_number(5));
+	ASSERT_EQ(mint::Data::FMT_OBJECT, b.data()->format);
+
+	{
+		mint::WeakReference result = scheduler.invoke(fn, mint::WeakReference::share(a), mint::WeakReference::share(b));
+		ASSERT_EQ(mint::Data::FMT_NUMBER, result.data()->format);
+		EXPECT_EQ(3, result.data<mint::Number>()->value);
+	}
+
+	{
+		mint::WeakReference result = scheduler.invoke(fn, mint::WeakReference::share(b), mint::WeakReference::share(a));
+		ASSERT_EQ(mint::Data::FMT_NUMBER, result.data()->format);
+		EXPECT_EQ(3, result.data<mint::Number>()->value);
+	}
+
+	EXPECT_TRUE(scheduler.disable_testing(thread));
+}
+
+TEST(processor, constant_folding) {
+
+	mint::Scheduler scheduler(0, nullptr);
+	mint::AbstractSyntaxTree *ast = scheduler.ast();
+	mint::Module::Info module = ast->create_module(mint::Module::READY);
+
+	mint::Process *thread = scheduler.enable_testing();
+	ASSERT_NE(nullptr, thread);
+
+	mint::WeakReference fn = mint::create_function(module, 0, R"(
+        def () {
+            return 60 * 60 * 24
+        }
+    )");
+	ASSERT_EQ(mint::Data::FMT_FUNCTION, fn.data()->format);
+
+	const mint::Module::Handle *handle = fn.data<mint::Function>()->mapping.begin()->second.handle;
+	ASSERT_EQ(mint::Node::LOAD_CONSTANT, module.module->at(handle->offset).command);
+	mint::Reference *constant = module.module->at(handle->offset + 1).constant;
+	ASSERT_EQ(mint::Data::FMT_NUMBER, constant->data()->format);
+	EXPECT_EQ(86400, constant->data<mint::Number>()->value);
+	EXPECT_EQ(mint::Node::EXIT_CALL, module.module->at(handle->offset + 2).command);
+
+	fn = mint::create_function(module, 1, R"(
+        def (n) {
+            if false {
+                n = n + 1
+            }
+            while true {
+                if n >= 3 {
+                    break
+                }
+                n = n + 1
+            }
+            return [n, 'a' + 'b', not true, -1, 2 ** 3 == 8, 1 + '2']
+        }
+    )");
+	ASSERT_EQ(mint::Data::FMT_FUNCTION, fn.data()->format);
+
+	mint::WeakReference result = scheduler.invoke(fn, mint::create_number(0));
+	ASSERT_EQ(mint::Data::FMT_OBJECT, result.data()->format);
+	EXPECT_EQ("[3, ab, false, -1, true, 3]", mint::to_string(result));
+
+	EXPECT_TRUE(scheduler.disable_testing(thread));
+}
+
+TEST(processor, lock_handoff) {
+
+	const mint::ProcessorLockStatistics before = mint::processor_lock_statistics();
+	std::vector<int> order;
+
+	mint::lock_processor();
+
+	std::thread first([&order] {
+		mint::lock_processor();
+		order.push_back(1);
+		mint::unlock_processor();
+	});
+
+	while (mint::processor_lock_statistics().contentions < before.contentions + 1) {
+		std::this_thread::yield();
+	}
+
+	std::thread second([&order] {
+		mint::lock_processor();
+		order.push_back(2);
+		mint::unlock_processor();
+	});
+
+	while (mint::processor_lock_statistics().contentions < before.contentions + 2) {
+		std::this_thread::yield();
+	}
+
+	// let the waiters request a switch
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+	order.push_back(0);
+	mint::unlock_processor();
+
+	first.join();
+	second.join();
+
+	const mint::ProcessorLockStatistics after = mint::processor_lock_statistics();
+	EXPECT_EQ(std::vector<int>({0, 1, 2}), order);
+	EXPECT_EQ(before.acquisitions + 3, after.acquisitions);
+	EXPECT_EQ(before.contentions + 2, after.contentions);
+	EXPECT_LE(before.handoffs + 1, after.handoffs);
+	EXPECT_LT(before.wait_time, after.wait_time);
+}
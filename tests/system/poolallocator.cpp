@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <mint/system/poolallocator.hpp>
+
+#include <vector>
+
+using namespace mint;
+
+TEST(poolallocator, allocate) {
+
+	PoolAllocator<double> allocator;
+
+	double *first = allocator.allocate();
+	double *second = allocator.allocate();
+	EXPECT_NE(first, second);
+	EXPECT_EQ(1, allocator.chunk_count());
+
+	allocator.deallocate(second);
+	EXPECT_EQ(second, allocator.allocate());
+
+	allocator.deallocate(first);
+	allocator.deallocate(second);
+}
+
+TEST(poolallocator, reclaim) {
+
+	using allocator_type = PoolAllocator<double>;
+	allocator_type allocator;
+
+	std::vector<double *> items;
+	for (size_t i = 0; i < 1000; ++i) {
+		items.push_back(allocator.allocate());
+	}
+
+	const size_t chunk_count = allocator.chunk_count();
+	EXPECT_LT(1, chunk_count);
+	EXPECT_EQ(0, allocator.reclaim(0));
+
+	// the first chunk is kept by its remaining item
+	for (size_t i = 1; i < items.size(); ++i) {
+		allocator.deallocate(items[i]);
+	}
+
+	EXPECT_EQ(0, allocator.reclaim(1));
+	EXPECT_EQ(chunk_count, allocator.chunk_count());
+
+	// the last chunks are released with their unused items
+	size_t capacity = 0;
+	for (size_t i = 0, size = allocator_type::MIN_SIZE * 2; i < chunk_count; ++i, size *= 2) {
+		capacity += size;
+	}
+	const size_t first_capacity = allocator_type::MIN_SIZE * 2;
+	const size_t expected = (chunk_count - 1) * allocator_type::HEADER_SIZE + (capacity - first_capacity) * allocator_type::ALIGNED_SIZE;
+	EXPECT_EQ(expected, allocator.reclaim(1));
+	EXPECT_EQ(1, allocator.chunk_count());
+
+	// the free items of the remaining chunk are still available
+	std::vector<double *> remaining;
+	for (size_t i = 1; i < first_capacity; ++i) {
+		remaining.push_back(allocator.allocate());
+	}
+	EXPECT_EQ(1, allocator.chunk_count());
+	for (double *item : remaining) {
+		allocator.deallocate(item);
+	}
+
+	allocator.deallocate(items.front());
+	EXPECT_EQ(allocator_type::HEADER_SIZE + first_capacity * allocator_type::ALIGNED_SIZE, allocator.reclaim(0));
+	EXPECT_EQ(0, allocator.chunk_count());
+
+	double *item = allocator.allocate();
+	EXPECT_EQ(1, allocator.chunk_count());
+	allocator.deallocate(item);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <mint/system/stackallocator.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace mint;
+
+TEST(stackallocator, allocate) {
+
+	StackAllocator allocator;
+
+	void *first = allocator.allocate(1);
+	void *second = allocator.allocate(24);
+	EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(first) % StackAllocator::ALIGNMENT);
+	EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(second) % StackAllocator::ALIGNMENT);
+	EXPECT_EQ(static_cast<byte_t *>(first) + StackAllocator::ALIGNMENT, second);
+
+	allocator.deallocate(second);
+	EXPECT_EQ(second, allocator.allocate(16));
+
+	allocator.deallocate(first);
+	EXPECT_EQ(first, allocator.allocate(8));
+	allocator.deallocate(first);
+}
+
+TEST(stackallocator, blocks) {
+
+	StackAllocator allocator;
+
+	void *first = allocator.allocate(StackAllocator::BLOCK_SIZE - StackAllocator::ALIGNMENT);
+	void *second = allocator.allocate(2 * StackAllocator::ALIGNMENT);
+	void *large = allocator.allocate(2 * StackAllocator::BLOCK_SIZE);
+	EXPECT_NE(static_cast<byte_t *>(first) + StackAllocator::BLOCK_SIZE - StackAllocator::ALIGNMENT, second);
+
+	// the blocks are kept for the next allocations
+	allocator.deallocate(large);
+	EXPECT_EQ(large, allocator.allocate(StackAllocator::BLOCK_SIZE + StackAllocator::ALIGNMENT));
+	allocator.deallocate(large);
+	allocator.deallocate(second);
+	EXPECT_EQ(second, allocator.allocate(StackAllocator::ALIGNMENT));
+	allocator.deallocate(second);
+
+	allocator.deallocate(first);
+	EXPECT_EQ(first, allocator.allocate(StackAllocator::ALIGNMENT));
+	EXPECT_EQ(static_cast<byte_t *>(first) + StackAllocator::ALIGNMENT, allocator.allocate(StackAllocator::ALIGNMENT));
+}
+
+TEST(stackallocator, large_frame) {
+
+	StackAllocator allocator;
+
+	void *first = allocator.allocate(StackAllocator::BLOCK_SIZE);
+	void *second = allocator.allocate(StackAllocator::BLOCK_SIZE);
+	void *third = allocator.allocate(StackAllocator::BLOCK_SIZE);
+	allocator.deallocate(third);
+	allocator.deallocate(second);
+	allocator.deallocate(first);
+	EXPECT_EQ(first, allocator.allocate(StackAllocator::BLOCK_SIZE));
+
+	// the kept blocks are too small for this frame and must be replaced
+	void *large = allocator.allocate(2 * StackAllocator::BLOCK_SIZE);
+	std::memset(large, 0, 2 * StackAllocator::BLOCK_SIZE);
+	allocator.deallocate(large);
+	EXPECT_EQ(large, allocator.allocate(2 * StackAllocator::BLOCK_SIZE));
+	allocator.deallocate(large);
+	allocator.deallocate(first);
+}